@@ -0,0 +1,350 @@
+#include "DealIndex.h"
+
+using namespace dengine;
+
+//-----------------------------------------------------------------------------------------------------------------------
+// DealIndex STRUCT
+//-----------------------------------------------------------------------------------------------------------------------
+
+DealIndex DealIndex::operator + (const DealIndex& other) const
+{
+    DealIndex sum(High + other.High, Low + other.Low);
+    sum.High += sum.Low < Low;
+    return sum;
+}
+
+DealIndex DealIndex::operator - (const DealIndex& other) const
+{
+    DealIndex difference(High - other.High, Low - other.Low);
+    difference.High -= Low < other.Low;
+    return difference;
+}
+
+void DealIndex::MultiplyAdd(uint32_t factor, uint64_t addend)
+{
+    // Low * factor split in 32-bit halves so the carry into High is not lost
+    const uint64_t low_part  = (Low & 0xFFFFFFFFu) * factor;
+    const uint64_t high_part = (Low >> 32) * factor;
+    const uint64_t low       = low_part + (high_part << 32);
+
+    High = High * factor + (high_part >> 32) + (low < low_part);
+    Low  = low + addend;
+    High += Low < low;
+}
+
+uint32_t DealIndex::DivideSmall(uint32_t divisor)
+{
+    // Long division over the four 32-bit digits
+    const uint32_t digits[4] = { static_cast<uint32_t>(High >> 32), static_cast<uint32_t>(High), static_cast<uint32_t>(Low >> 32), static_cast<uint32_t>(Low) };
+    uint32_t       quotient[4];
+    uint64_t       remainder = 0;
+    for (int i = 0; i < 4; i++) {
+        const uint64_t current = (remainder << 32) | digits[i];
+        quotient[i] = static_cast<uint32_t>(current / divisor);
+        remainder   = current % divisor;
+    }
+
+    High = (static_cast<uint64_t>(quotient[0]) << 32) | quotient[1];
+    Low  = (static_cast<uint64_t>(quotient[2]) << 32) | quotient[3];
+    return static_cast<uint32_t>(remainder);
+}
+
+DealIndex DealIndex::Divide(const DealIndex& divisor, DealIndex& remainder) const
+{
+    // Shift and subtract, only used a handful of times per analysis so the simple way is fine
+    DealIndex quotient;
+    remainder = DealIndex();
+    for (int bit = 127; bit >= 0; bit--) {
+        remainder.High = (remainder.High << 1) | (remainder.Low >> 63);
+        remainder.Low  = (remainder.Low << 1) | ((bit >= 64 ? High >> (bit - 64) : Low >> bit) & 1);
+        if (remainder >= divisor) {
+            remainder = remainder - divisor;
+            if (bit >= 64) quotient.High |= uint64_t(1) << (bit - 64);
+            else           quotient.Low  |= uint64_t(1) << bit;
+        }
+    }
+    return quotient;
+}
+
+std::string DealIndex::ToString() const
+{
+    if (FitsIn64Bits()) {
+        return std::to_string(Low);
+    }
+
+    // Nine decimal digits at a time, least significant first
+    DealIndex   value = *this;
+    std::string text;
+    while (!value.FitsIn64Bits() || value.Low >= 1000000000u) {
+        std::string digits = std::to_string(value.DivideSmall(1000000000u));
+        text = std::string(9 - digits.size(), '0') + digits + text;
+    }
+    return std::to_string(value.Low) + text;
+}
+
+bool DealIndex::FromString(const char* text, DealIndex& index)
+{
+    index = DealIndex();
+    if (*text == '\0') {
+        return false;
+    }
+    for (; *text != '\0'; text++) {
+        if (*text < '0' || *text > '9' || index.High >= (uint64_t(1) << 60)) {
+            return false;
+        }
+        index.MultiplyAdd(10, static_cast<uint64_t>(*text - '0'));
+    }
+    return true;
+}
+
+//-----------------------------------------------------------------------------------------------------------------------
+// PositionSignature STRUCT
+//-----------------------------------------------------------------------------------------------------------------------
+
+PositionSignature PositionSignature::Of(const DominoEngine& engine)
+{
+    PositionSignature signature;
+    signature.NumberOfPlayers = engine.GetNumberOfPlayers();
+    signature.BoardTiles      = static_cast<uint8_t>(std::popcount(engine.GetPlayedTiles()));
+    for (uint16_t p = 0; p < signature.NumberOfPlayers; p++) {
+        signature.Cards[p] = static_cast<uint8_t>(engine.RemainingCards(p));
+    }
+    return signature;
+}
+
+uint32_t PositionSignature::Key() const
+{
+    uint32_t key = static_cast<uint32_t>(NumberOfPlayers - MinPlayers);
+    for (uint16_t p = 0; p < MaxPlayers; p++) {
+        key |= static_cast<uint32_t>(p < NumberOfPlayers ? Cards[p] : 0) << (3 + 3 * p);
+    }
+    return key | static_cast<uint32_t>(BoardTiles) << 27;
+}
+
+//-----------------------------------------------------------------------------------------------------------------------
+// Ranking
+//-----------------------------------------------------------------------------------------------------------------------
+
+namespace
+{
+constexpr std::array<std::array<uint32_t, NumberOfTiles + 1>, NumberOfTiles + 1> MakeBinomialTable()
+{
+    std::array<std::array<uint32_t, NumberOfTiles + 1>, NumberOfTiles + 1> table{};
+    for (int n = 0; n <= NumberOfTiles; n++) {
+        table[n][0] = 1;
+        for (int k = 1; k <= n; k++) {
+            table[n][k] = table[n - 1][k - 1] + (k < n ? table[n - 1][k] : 0);
+        }
+    }
+    return table;
+}
+
+constexpr auto BinomialTable = MakeBinomialTable();
+
+// The position of the tile among the set tiles of the universe
+uint32_t TilePosition(TileMask universe, uint8_t tile)
+{
+    return static_cast<uint32_t>(std::popcount(universe & ((TileMask(1) << tile) - 1)));
+}
+
+// The tile at the position among the set tiles of the universe
+uint8_t TileAtPosition(TileMask universe, uint32_t position)
+{
+    for (; position > 0; position--) {
+        universe &= universe - 1;
+    }
+    return static_cast<uint8_t>(std::countr_zero(universe));
+}
+
+// Position part of the index past the partition: the board ends, the turns and the passes
+uint32_t BoardStates(const PositionSignature& signature)
+{
+    // Both open ends, or whether the opening tile is forced when there is nothing on the board
+    return signature.BoardTiles == 0 ? 2 : (HighestPip + 1) * (HighestPip + 1);
+}
+
+void PartitionSizes(const PositionSignature& signature, std::array<uint8_t, MaxPlayers + 1>& sizes)
+{
+    for (uint16_t p = 0; p < signature.NumberOfPlayers; p++) {
+        sizes[p] = signature.Cards[p];
+    }
+    sizes[signature.NumberOfPlayers] = signature.BoardTiles;
+}
+}
+
+uint32_t deal_index::Binomial(int n, int k)
+{
+    if (n < 0 || k < 0 || k > n) {
+        return 0;
+    }
+    return BinomialTable[n][k];
+}
+
+DealIndex deal_index::CountPartitions(const uint8_t* sizes, uint16_t parts)
+{
+    DealIndex count(1);
+    int       tiles_left = NumberOfTiles;
+    for (uint16_t i = 0; i < parts; i++) {
+        count.MultiplyAdd(Binomial(tiles_left, sizes[i]), 0);
+        tiles_left -= sizes[i];
+    }
+    return count;
+}
+
+DealIndex deal_index::RankPartition(const TileMask* masks, uint16_t parts)
+{
+    // Colex rank of every part among the subsets of the tiles the earlier parts left
+    std::array<uint32_t, MaxPlayers + 1> ranks{};
+    std::array<uint32_t, MaxPlayers + 1> radices{};
+    TileMask universe = (TileMask(1) << NumberOfTiles) - 1;
+    for (uint16_t i = 0; i < parts; i++) {
+        uint32_t k = 0;
+        for (TileMask m = masks[i]; m; m &= m - 1) {
+            ranks[i] += Binomial(TilePosition(universe, static_cast<uint8_t>(std::countr_zero(m))), ++k);
+        }
+        radices[i] = Binomial(std::popcount(universe), k);
+        universe  &= ~masks[i];
+    }
+
+    // The first part is the least significant digit
+    DealIndex index;
+    for (int i = parts - 1; i >= 0; i--) {
+        index.MultiplyAdd(radices[i], ranks[i]);
+    }
+    return index;
+}
+
+bool deal_index::UnrankPartition(DealIndex index, const uint8_t* sizes, uint16_t parts, TileMask* masks)
+{
+    TileMask universe = (TileMask(1) << NumberOfTiles) - 1;
+    for (uint16_t i = 0; i < parts; i++) {
+        const int size = std::popcount(universe);
+        if (sizes[i] > size) {
+            return false;
+        }
+
+        uint32_t rank = index.DivideSmall(Binomial(size, sizes[i]));
+        masks[i] = 0;
+        for (int k = sizes[i], position = size - 1; k > 0; k--) {
+            while (Binomial(position, k) > rank) {
+                position--;
+            }
+            rank     -= Binomial(position, k);
+            masks[i] |= TileMask(1) << TileAtPosition(universe, position);
+            position--;
+        }
+        universe &= ~masks[i];
+    }
+    // Anything left means the index was out of range
+    return index == DealIndex();
+}
+
+DealIndex deal_index::NumberOfDeals(uint16_t number_of_players)
+{
+    std::array<uint8_t, MaxPlayers> sizes;
+    sizes.fill(static_cast<uint8_t>(CardsPerPlayer(number_of_players)));
+    return CountPartitions(sizes.data(), number_of_players);
+}
+
+DealIndex deal_index::RankDeal(const DominoEngine& engine)
+{
+    std::array<TileMask, MaxPlayers> hands;
+    for (uint16_t p = 0; p < engine.GetNumberOfPlayers(); p++) {
+        hands[p] = engine.GetHand(p);
+    }
+    return RankPartition(hands.data(), engine.GetNumberOfPlayers());
+}
+
+bool deal_index::UnrankDeal(uint16_t number_of_players, DealIndex index, DominoEngine& engine, int first_turn)
+{
+    std::array<uint8_t, MaxPlayers>  sizes;
+    std::array<TileMask, MaxPlayers> hands;
+    sizes.fill(static_cast<uint8_t>(CardsPerPlayer(number_of_players)));
+    if (!UnrankPartition(index, sizes.data(), number_of_players, hands.data())) {
+        return false;
+    }
+
+    engine.ClearPosition(number_of_players);
+    for (uint16_t p = 0; p < number_of_players; p++) {
+        for (TileMask m = hands[p]; m; m &= m - 1) {
+            engine.GiveTile(p, static_cast<uint8_t>(std::countr_zero(m)));
+        }
+    }
+    engine.StartGame(first_turn);
+    return true;
+}
+
+DealIndex deal_index::NumberOfPositions(const PositionSignature& signature)
+{
+    std::array<uint8_t, MaxPlayers + 1> sizes;
+    PartitionSizes(signature, sizes);
+
+    const uint32_t players = signature.NumberOfPlayers;
+    DealIndex      count   = CountPartitions(sizes.data(), static_cast<uint16_t>(players + 1));
+    count.MultiplyAdd(BoardStates(signature), 0);
+    count.MultiplyAdd(players * players * (players + 1), 0);
+    return count;
+}
+
+DealIndex deal_index::RankPosition(const DominoEngine& engine)
+{
+    const PositionSignature signature = PositionSignature::Of(engine);
+    const uint16_t          players   = signature.NumberOfPlayers;
+
+    std::array<TileMask, MaxPlayers + 1> masks;
+    for (uint16_t p = 0; p < players; p++) {
+        masks[p] = engine.GetHand(p);
+    }
+    masks[players] = engine.GetPlayedTiles();
+
+    const uint32_t board_state = signature.BoardTiles == 0 ? (engine.GetRequiredTile() != NoTile ? 1 : 0)
+                                                           : engine.GetLeftEnd() * (HighestPip + 1) + engine.GetRightEnd();
+
+    // The partition rank is the most significant digit, followed by the board state, the turns and the passes
+    DealIndex index = RankPartition(masks.data(), players + 1);
+    index.MultiplyAdd(BoardStates(signature), board_state);
+    index.MultiplyAdd(players, engine.GetCurrentTurn());
+    index.MultiplyAdd(players, engine.GetFirstTurn());
+    index.MultiplyAdd(players + 1, engine.GetNumberOfPasses());
+    return index;
+}
+
+bool deal_index::UnrankPosition(const PositionSignature& signature, DealIndex index, DominoEngine& engine)
+{
+    const uint16_t players = signature.NumberOfPlayers;
+
+    std::array<uint8_t, MaxPlayers + 1> sizes;
+    PartitionSizes(signature, sizes);
+
+    const uint32_t passes       = index.DivideSmall(players + 1);
+    const uint32_t first_turn   = index.DivideSmall(players);
+    const uint32_t current_turn = index.DivideSmall(players);
+    const uint32_t board_state  = index.DivideSmall(BoardStates(signature));
+
+    std::array<TileMask, MaxPlayers + 1> masks;
+    if (!UnrankPartition(index, sizes.data(), players + 1, masks.data())) {
+        return false;
+    }
+
+    engine.ClearPosition(players);
+    TileMask hands = 0;
+    for (uint16_t p = 0; p < players; p++) {
+        hands |= masks[p];
+        for (TileMask m = masks[p]; m; m &= m - 1) {
+            engine.GiveTile(p, static_cast<uint8_t>(std::countr_zero(m)));
+        }
+    }
+    for (TileMask m = masks[players]; m; m &= m - 1) {
+        engine.SetPlayedTile(static_cast<uint8_t>(std::countr_zero(m)));
+    }
+
+    if (signature.BoardTiles == 0) {
+        engine.SetRequiredTile(board_state == 1 ? OpeningTile(hands) : NoTile);
+    }
+    else {
+        engine.SetBoardEnds(static_cast<uint8_t>(board_state / (HighestPip + 1)), static_cast<uint8_t>(board_state % (HighestPip + 1)));
+    }
+    engine.SetTurns(static_cast<uint16_t>(current_turn), static_cast<uint16_t>(first_turn), signature.BoardTiles);
+    engine.SetNumberOfPasses(static_cast<uint16_t>(passes));
+    return true;
+}
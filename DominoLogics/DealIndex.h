@@ -0,0 +1,79 @@
+#pragma once
+
+#include "DominoEngine.h"
+#include <compare>
+#include <string>
+
+//-----------------------------------------------------------------------------------------------------------------------
+// Dense indices of deals and positions.
+// A deal is a partition of the tiles into the hands of the players plus the leftover tiles, ranked with the
+// combinatorial number system: every hand is ranked as a subset of the tiles the earlier hands did not take and the
+// ranks are combined in mixed radix. Every index below the count is a different deal, so deals can be stored as one
+// number, analyses can be split by index ranges and samples can be stratified over the whole deal space.
+// Four to six player deals fit in 64 bits, seven and eight player deals need up to 70 bits.
+//-----------------------------------------------------------------------------------------------------------------------
+
+// Unsigned 128-bit integer with just what the indexing needs, since not every compiler has one
+struct DealIndex
+{
+	uint64_t High = 0;
+	uint64_t Low  = 0;
+
+	constexpr DealIndex() = default;
+	constexpr DealIndex(uint64_t value) : Low(value) {}
+	constexpr DealIndex(uint64_t high, uint64_t low) : High(high), Low(low) {}
+
+	constexpr bool FitsIn64Bits() const { return High == 0; }
+	constexpr auto operator <=> (const DealIndex& other) const = default;
+
+	DealIndex operator + (const DealIndex& other) const;
+	DealIndex operator - (const DealIndex& other) const;
+
+	// *this = *this * factor + addend
+	void      MultiplyAdd(uint32_t factor, uint64_t addend);
+	// *this /= divisor and returns the remainder
+	uint32_t  DivideSmall(uint32_t divisor);
+	DealIndex Divide(const DealIndex& divisor, DealIndex& remainder) const;
+
+	std::string ToString() const;
+	static bool FromString(const char* text, DealIndex& index);
+};
+
+// The hand sizes of a position plus the number of tiles on the board. Positions are indexed within their signature
+struct PositionSignature
+{
+	uint16_t                                 NumberOfPlayers = dengine::MinPlayers;
+	std::array<uint8_t, dengine::MaxPlayers> Cards{};
+	uint8_t                                  BoardTiles      = 0;
+
+	static PositionSignature Of(const DominoEngine& engine);
+
+	// Packs the signature in 32 bits: 3 bits for the players, 3 bits for every hand and 5 bits for the board
+	uint32_t Key() const;
+	bool     operator == (const PositionSignature& other) const = default;
+};
+
+namespace deal_index
+{
+uint32_t Binomial(int n, int k);
+
+// Partitions of the tiles into parts of the given sizes, the tiles left are not part of any
+DealIndex CountPartitions(const uint8_t* sizes, uint16_t parts);
+DealIndex RankPartition(const dengine::TileMask* masks, uint16_t parts);
+// False if the index is not below CountPartitions
+bool      UnrankPartition(DealIndex index, const uint8_t* sizes, uint16_t parts, dengine::TileMask* masks);
+
+// Deals of the number of players, the hands in seat order
+DealIndex NumberOfDeals(uint16_t number_of_players);
+// Ranks the hands of the engine. The engine must not have played any tile yet
+DealIndex RankDeal(const DominoEngine& engine);
+// Deals the hands of the index and starts the game like DominoEngine::NewGame
+bool      UnrankDeal(uint16_t number_of_players, DealIndex index, DominoEngine& engine, int first_turn = -1);
+
+// Positions of the signature: the hands and the board tiles, the open ends (or, with an empty board, whether the
+// opening tile is forced), the current turn, the first turn and the number of passes in a row. The number of turns
+// does not change how the game goes on, so it is not part of the index and unranked positions count the board tiles
+DealIndex NumberOfPositions(const PositionSignature& signature);
+DealIndex RankPosition(const DominoEngine& engine);
+bool      UnrankPosition(const PositionSignature& signature, DealIndex index, DominoEngine& engine);
+}
@@ -0,0 +1,132 @@
+#include "DominoBot.h"
+#include <algorithm>
+
+using namespace dengine;
+
+//-----------------------------------------------------------------------------------------------------------------------
+// DominoBot CLASS
+//-----------------------------------------------------------------------------------------------------------------------
+
+DominoBot::DominoBot(int ai_difficulty) :
+    AIDifficulty(ai_difficulty)
+{}
+
+void DominoBot::SetDifficulty(int ai_difficulty)
+{
+    AIDifficulty = ai_difficulty;
+}
+
+int DominoBot::GetDifficulty() const
+{
+    return AIDifficulty;
+}
+
+bool DominoBot::LoadWeights(const char* path)
+{
+    return Evaluator.LoadWeights(path);
+}
+
+void DominoBot::SetSearchLimits(const SearchLimits& limits)
+{
+    Limits = limits;
+}
+
+const SearchLimits& DominoBot::GetSearchLimits() const
+{
+    return Limits;
+}
+
+void DominoBot::SetTranspositionTable(TranspositionTable* table)
+{
+    Table = table;
+}
+
+void DominoBot::SetTablebase(const Tablebase* table)
+{
+    Endgame = table;
+}
+
+DominoMove DominoBot::SelectMove(const DominoEngine& engine, std::mt19937& rng) const
+{
+    return DispatchPlayers(engine.GetNumberOfPlayers(), [&](auto players) { return SelectMove<players()>(engine, rng); });
+}
+
+template<uint16_t N, typename Engine>
+DominoMove DominoBot::SelectMove(const Engine& engine, std::mt19937& rng) const
+{
+    DominoMove forced;
+    if (engine.GetForcedMove(forced)) {
+        return forced;
+    }
+
+    switch (AIDifficulty)
+    {
+    case AIDifficulty_Random:    return RandomMove(engine, rng);
+    case AIDifficulty_Hard: {
+        BasicDominoSearch<Engine> search(Evaluator, Limits);
+        search.SetTranspositionTable(Table);
+        search.SetTablebase(Endgame);
+        return search.ExpectiMax(engine, rng).Move;
+    }
+    case AIDifficulty_GigaBrain: {
+        BasicDominoSearch<Engine> search(Evaluator, Limits);
+        search.SetTablebase(Endgame);
+        return search.Mcts(engine, rng).Move;
+    }
+    default:                     return Evaluator.SelectMove<N>(engine, rng);
+    }
+}
+
+template<typename Engine>
+uint16_t DominoBot::PlayGame(Engine& engine, const DominoBot* const* seats, std::mt19937& rng)
+{
+    return DispatchPlayers(engine.GetNumberOfPlayers(), [&](auto players) { return PlayGame<players()>(engine, seats, rng); });
+}
+
+template<uint16_t N, typename Engine>
+uint16_t DominoBot::PlayGame(Engine& engine, const DominoBot* const* seats, std::mt19937& rng)
+{
+    while (!engine.IsGameOver()) {
+        engine.template PlayMoveN<N>(seats[engine.GetCurrentTurn()]->template SelectMove<N>(engine, rng));
+    }
+    return engine.GetWinner();
+}
+
+template uint16_t DominoBot::PlayGame(DominoEngine& engine, const DominoBot* const* seats, std::mt19937& rng);
+template uint16_t DominoBot::PlayGame(BasicDominoEngine<DoubleSix, DrawRules>& engine, const DominoBot* const* seats, std::mt19937& rng);
+template uint16_t DominoBot::PlayGame(BasicDominoEngine<DoubleSix, AllFivesRules>& engine, const DominoBot* const* seats, std::mt19937& rng);
+template uint16_t DominoBot::PlayGame<4>(DominoEngine& engine, const DominoBot* const* seats, std::mt19937& rng);
+template uint16_t DominoBot::PlayGame<5>(DominoEngine& engine, const DominoBot* const* seats, std::mt19937& rng);
+template uint16_t DominoBot::PlayGame<6>(DominoEngine& engine, const DominoBot* const* seats, std::mt19937& rng);
+template uint16_t DominoBot::PlayGame<7>(DominoEngine& engine, const DominoBot* const* seats, std::mt19937& rng);
+template uint16_t DominoBot::PlayGame<8>(DominoEngine& engine, const DominoBot* const* seats, std::mt19937& rng);
+
+template<typename Engine>
+DominoMove DominoBot::RandomMove(const Engine& engine, std::mt19937& rng) const
+{
+    DominoMoveList moves;
+    engine.GenerateMoves(moves);
+    if (moves.Size == 1) {
+        return moves[0];
+    }
+
+    std::array<uint8_t, NumberOfTiles> cards;
+    uint16_t number_of_cards = 0;
+    for (TileMask m = engine.GetHand(engine.GetCurrentTurn()); m; m &= m - 1) {
+        cards[number_of_cards++] = static_cast<uint8_t>(std::countr_zero(m));
+    }
+    std::shuffle(cards.begin(), cards.begin() + number_of_cards, rng);
+
+    for (uint16_t c = 0; c < number_of_cards; c++) {
+        const DominoMove right(cards[c], EngineSide_Right);
+        const DominoMove left(cards[c], EngineSide_Left);
+        if (std::find(moves.begin(), moves.end(), right) != moves.end()) {
+            return right;
+        }
+        if (std::find(moves.begin(), moves.end(), left) != moves.end()) {
+            return left;
+        }
+    }
+
+    return moves[0];
+}
@@ -0,0 +1,51 @@
+#pragma once
+
+#include "DominoEngine.h"
+#include "DominoEvaluator.h"
+#include "DominoSearch.h"
+
+//-----------------------------------------------------------------------------------------------------------------------
+// DominoBot CLASS
+//-----------------------------------------------------------------------------------------------------------------------
+
+// Headless counterpart of DominoAI. Picks the move of the current player of an engine for a given AI difficulty,
+// so simulations and match tools can seat any AI configuration without the UI.
+// Works with the engine of every double-six rule variant: Hard is BasicDominoSearch::ExpectiMax and GigaBrain is
+// BasicDominoSearch::Mcts, both handling the draws of the boneyard variants as chance nodes
+class DominoBot
+{
+private:
+	int                 AIDifficulty;
+	DominoEvaluator     Evaluator;
+	SearchLimits        Limits;
+	TranspositionTable* Table   = nullptr;
+	const Tablebase*    Endgame = nullptr;
+
+public:
+	DominoBot(int ai_difficulty = AIDifficulty_Random);
+
+	void                SetDifficulty(int ai_difficulty);
+	int                 GetDifficulty() const;
+	bool                LoadWeights(const char* path);
+	void                SetSearchLimits(const SearchLimits& limits);
+	const SearchLimits& GetSearchLimits() const;
+	// The table of the Hard searches, none by default. Bots on different threads can share one
+	void                SetTranspositionTable(TranspositionTable* table);
+	// The endgame table of the Hard and GigaBrain searches, none by default
+	void                SetTablebase(const Tablebase* table);
+	DominoMove          SelectMove(const DominoEngine& engine, std::mt19937& rng) const;
+	template<uint16_t N, typename Engine>
+	DominoMove          SelectMove(const Engine& engine, std::mt19937& rng) const;
+
+	// Plays the game until it's over, seats[p] choosing the moves of player p. Returns the winner.
+	// Dispatches once on the number of players and plays the whole game with the code specialized for it
+	template<typename Engine>
+	static uint16_t PlayGame(Engine& engine, const DominoBot* const* seats, std::mt19937& rng);
+	template<uint16_t N, typename Engine>
+	static uint16_t PlayGame(Engine& engine, const DominoBot* const* seats, std::mt19937& rng);
+
+private:
+	// Same as DominoAI::RandomCompute. Shuffles the cards and uses the foremost usable card, right side first
+	template<typename Engine>
+	DominoMove RandomMove(const Engine& engine, std::mt19937& rng) const;
+};
@@ -0,0 +1,756 @@
+#include "DominoEngine.h"
+#include <algorithm>
+
+using namespace dengine;
+
+//-----------------------------------------------------------------------------------------------------------------------
+// BasicDominoEngine CLASS
+//-----------------------------------------------------------------------------------------------------------------------
+
+template<typename Set, typename Rules>
+BasicDominoEngine<Set, Rules>::BasicDominoEngine()
+{
+    ClearPosition(Set::MinPlayers);
+}
+
+template<typename Set, typename Rules>
+void BasicDominoEngine<Set, Rules>::NewGame(uint16_t number_of_players, uint32_t seed, int first_turn, uint16_t number_of_cards)
+{
+    ClearPosition(number_of_players, number_of_cards);
+    DistributeCards(seed);
+    StartGame(first_turn);
+}
+
+template<typename Set, typename Rules>
+void BasicDominoEngine<Set, Rules>::StartGame(int first_turn)
+{
+    if (first_turn < 0) {
+        FindFirstPlayerTurn();
+    }
+    else {
+        CurrentTurn = FirstTurn = static_cast<uint16_t>(first_turn);
+    }
+}
+
+template<typename Set, typename Rules>
+void BasicDominoEngine<Set, Rules>::ClearPosition(uint16_t number_of_players, uint16_t number_of_cards)
+{
+    Hands.fill(Mask());
+    PlayedTiles     = Mask();
+    NumberOfPlayers = number_of_players;
+    NumberOfCards   = number_of_cards != 0 ? std::min(number_of_cards, MaxCards) : Set::CardsPerPlayer(number_of_players);
+    CurrentTurn     = 0;
+    FirstTurn       = 0;
+    NumberOfTurns   = 0;
+    NumberOfPasses  = 0;
+    PlayerWinner    = 0;
+    LeftEnd         = 0;
+    RightEnd        = 0;
+    RequiredTile    = NoTile;
+    GameOver        = false;
+    static_cast<RuleState&>(*this) = RuleState();
+}
+
+template<typename Set, typename Rules>
+void BasicDominoEngine<Set, Rules>::GiveTile(uint16_t player, uint8_t tile)
+{
+    Hands[player] |= TileBit<Mask>(tile);
+}
+
+template<typename Set, typename Rules>
+void BasicDominoEngine<Set, Rules>::SetPlayedTile(uint8_t tile)
+{
+    PlayedTiles |= TileBit<Mask>(tile);
+}
+
+template<typename Set, typename Rules>
+void BasicDominoEngine<Set, Rules>::SetBoardEnds(uint8_t left_end, uint8_t right_end)
+{
+    LeftEnd  = left_end;
+    RightEnd = right_end;
+}
+
+template<typename Set, typename Rules>
+void BasicDominoEngine<Set, Rules>::SetTurns(uint16_t current_turn, uint16_t first_turn, uint16_t number_of_turns)
+{
+    CurrentTurn   = current_turn;
+    FirstTurn     = first_turn;
+    NumberOfTurns = number_of_turns;
+}
+
+template<typename Set, typename Rules>
+void BasicDominoEngine<Set, Rules>::SetNumberOfPasses(uint16_t passes)
+{
+    NumberOfPasses = passes;
+}
+
+template<typename Set, typename Rules>
+void BasicDominoEngine<Set, Rules>::SetRequiredTile(uint8_t tile)
+{
+    RequiredTile = tile;
+}
+
+template<typename Set, typename Rules>
+void BasicDominoEngine<Set, Rules>::SetHand(uint16_t player, Mask hand)
+{
+    Hands[player] = hand;
+}
+
+template<typename Set, typename Rules>
+void BasicDominoEngine<Set, Rules>::SetBoneyard(Mask boneyard)
+{
+    if constexpr (Rules::UsesBoneyard) {
+        this->Boneyard = boneyard;
+    }
+    else {
+        (void)boneyard;
+    }
+}
+
+template<typename Set, typename Rules>
+void BasicDominoEngine<Set, Rules>::DistributeCards(uint32_t seed)
+{
+    std::array<uint8_t, Set::NumberOfTiles> deck;
+    for (uint8_t i = 0; i < Set::NumberOfTiles; i++) {
+        deck[i] = i;
+    }
+
+    std::mt19937 rng(seed);
+    std::shuffle(deck.begin(), deck.end(), rng);
+
+    int current_domino = 0;
+    for (int p_idx = 0; p_idx < NumberOfPlayers; p_idx++) {
+        for (int c = 0; c < NumberOfCards && current_domino < Set::NumberOfTiles; c++) {
+            GiveTile(p_idx, deck[current_domino++]);
+        }
+    }
+
+    if constexpr (Rules::UsesBoneyard) {
+        while (current_domino < Set::NumberOfTiles) {
+            this->Boneyard |= TileBit<Mask>(deck[current_domino++]);
+        }
+        this->DrawState = seed ^ 0x9E3779B97F4A7C15ull;
+    }
+}
+
+template<typename Set, typename Rules>
+void BasicDominoEngine<Set, Rules>::DrawTile(uint8_t tile)
+{
+    if constexpr (Rules::UsesBoneyard) {
+        if (tile == NoTile) {
+            // splitmix64, so a playout can draw without a generator of its own
+            uint64_t z = (this->DrawState += 0x9E3779B97F4A7C15ull);
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+            z ^= z >> 31;
+
+            Mask m = this->Boneyard;
+            for (uint64_t skip = z % CountTiles(m); skip > 0; skip--) {
+                m = WithoutLowestTile(m);
+            }
+            tile = LowestTile(m);
+        }
+
+        Hands[CurrentTurn] |= TileBit<Mask>(tile);
+        this->Boneyard     &= ~TileBit<Mask>(tile);
+    }
+}
+
+template<typename Set, typename Rules>
+void BasicDominoEngine<Set, Rules>::ScorePlay(uint8_t tile, bool first_tile)
+{
+    if constexpr (Rules::UsesScores) {
+        const bool double_tile = Set::Tiles[tile].Left == Set::Tiles[tile].Right;
+        uint16_t   ends_sum;
+        if (first_tile) {
+            // The opening tile is both ends, a double counts once
+            this->LeftDouble = this->RightDouble = double_tile;
+            ends_sum = LeftEnd + RightEnd;
+        }
+        else {
+            ends_sum = LeftEnd * (1 + this->LeftDouble) + RightEnd * (1 + this->RightDouble);
+        }
+        this->Scores[CurrentTurn] += Rules::PlayPoints(ends_sum);
+    }
+}
+
+template<typename Set, typename Rules>
+void BasicDominoEngine<Set, Rules>::ScoreHand()
+{
+    if constexpr (Rules::UsesScores) {
+        // The hand winner scores the pips of the other hands less the ones left in the winning hand, then the highest score takes the game.
+        // Ties go to the hand winner, then to the earlier turn
+        const uint16_t hand_winner = PlayerWinner;
+        const uint16_t own_pips    = SumOfCards(hand_winner);
+        uint16_t       other_pips  = 0;
+        for (uint16_t p = 0; p < NumberOfPlayers; p++) {
+            if (p != hand_winner) {
+                other_pips += SumOfCards(p);
+            }
+        }
+        this->Scores[hand_winner] += Rules::HandPoints(other_pips > own_pips ? other_pips - own_pips : 0);
+
+        for (uint16_t offset = 0; offset < NumberOfPlayers; offset++) {
+            const uint16_t p = (FirstTurn + offset) % NumberOfPlayers;
+            if (this->Scores[p] > this->Scores[PlayerWinner]) {
+                PlayerWinner = p;
+            }
+        }
+    }
+}
+
+template<typename Set, typename Rules>
+void BasicDominoEngine<Set, Rules>::FindFirstPlayerTurn()
+{
+    // The player that has the highest double, or the highest card if no one has a double
+    Mask dealt{};
+    for (uint16_t p = 0; p < NumberOfPlayers; p++) {
+        dealt |= Hands[p];
+    }
+
+    const uint8_t tile = Set::OpeningTile(dealt);
+    for (uint16_t p = 0; p < NumberOfPlayers && tile != NoTile; p++) {
+        if (Hands[p] & TileBit<Mask>(tile)) {
+            CurrentTurn = FirstTurn = p;
+            RequiredTile = tile;
+            return;
+        }
+    }
+}
+
+template<typename Set, typename Rules>
+template<uint16_t N>
+void BasicDominoEngine<Set, Rules>::FindTheLowestSum()
+{
+    // Lowest sum of cards, followed by less remaining cards, followed by the earlier turn
+    uint16_t current_winner = FirstTurn;
+    uint16_t lowest_sum     = SumOfCards(current_winner);
+    uint16_t lowest_cards   = RemainingCards(current_winner);
+
+    for (uint16_t offset = 1; offset < N; offset++) {
+        const uint16_t p         = (FirstTurn + offset) % N;
+        const uint16_t sum       = SumOfCards(p);
+        const uint16_t remaining = RemainingCards(p);
+
+        if (sum < lowest_sum || (sum == lowest_sum && remaining < lowest_cards)) {
+            current_winner = p;
+            lowest_sum     = sum;
+            lowest_cards   = remaining;
+        }
+    }
+
+    PlayerWinner = current_winner;
+}
+
+template<typename Set, typename Rules>
+template<uint16_t N>
+void BasicDominoEngine<Set, Rules>::TurnAdvance()
+{
+    NumberOfTurns++;
+    CurrentTurn++;
+    if (CurrentTurn == N) {
+        CurrentTurn = 0;
+    }
+}
+
+template<typename Set, typename Rules>
+void BasicDominoEngine<Set, Rules>::GenerateMoves(DominoMoveList& moves) const
+{
+    moves.Clear();
+    const Mask hand = Hands[CurrentTurn];
+
+    if (NoDominoesYet()) {
+        if (RequiredTile != NoTile) {
+            moves.Add(DominoMove(RequiredTile, EngineSide_Left));
+            return;
+        }
+        for (Mask m = hand; m; m = WithoutLowestTile(m)) {
+            moves.Add(DominoMove(LowestTile(m), EngineSide_Left));
+        }
+        return;
+    }
+
+    for (Mask m = hand & Set::PipTiles[LeftEnd]; m; m = WithoutLowestTile(m)) {
+        moves.Add(DominoMove(LowestTile(m), EngineSide_Left));
+    }
+    for (Mask m = hand & Set::PipTiles[RightEnd]; m; m = WithoutLowestTile(m)) {
+        moves.Add(DominoMove(LowestTile(m), EngineSide_Right));
+    }
+
+    if (moves.Size == 0) {
+        if constexpr (Rules::UsesBoneyard) {
+            if (this->Boneyard) {
+                moves.Add(DominoMove(NoTile, EngineSide_Draw));
+                return;
+            }
+        }
+        moves.Add(DominoMove());
+    }
+}
+
+template<typename Set, typename Rules>
+bool BasicDominoEngine<Set, Rules>::CurrentPlayerCanAttack() const
+{
+    if (NoDominoesYet()) {
+        return static_cast<bool>(Hands[CurrentTurn]);
+    }
+    return static_cast<bool>(Hands[CurrentTurn] & (Set::PipTiles[LeftEnd] | Set::PipTiles[RightEnd]));
+}
+
+template<typename Set, typename Rules>
+bool BasicDominoEngine<Set, Rules>::IsLegalMove(const DominoMove& move) const
+{
+    DominoMoveList moves;
+    GenerateMoves(moves);
+    return std::find(moves.begin(), moves.end(), move) != moves.end();
+}
+
+template<typename Set, typename Rules>
+bool BasicDominoEngine<Set, Rules>::GetForcedMove(DominoMove& move) const
+{
+    const Mask hand = Hands[CurrentTurn];
+    if (NoDominoesYet()) {
+        if (RequiredTile != NoTile) {
+            move = DominoMove(RequiredTile, EngineSide_Left);
+            return true;
+        }
+        if (CountTiles(hand) != 1) {
+            return false;
+        }
+        move = DominoMove(LowestTile(hand), EngineSide_Left);
+        return true;
+    }
+
+    const Mask left   = hand & Set::PipTiles[LeftEnd];
+    const Mask right  = hand & Set::PipTiles[RightEnd];
+    const Mask usable = left | right;
+    if (!usable) {
+        move = DominoMove();
+        if constexpr (Rules::UsesBoneyard) {
+            if (this->Boneyard) {
+                move = DominoMove(NoTile, EngineSide_Draw);
+            }
+        }
+        return true;
+    }
+
+    if (WithoutLowestTile(usable) || (left && right && LeftEnd != RightEnd)) {
+        return false;
+    }
+    move = DominoMove(LowestTile(usable), left ? EngineSide_Left : EngineSide_Right);
+    return true;
+}
+
+template<typename Set, typename Rules>
+uint16_t BasicDominoEngine<Set, Rules>::PlayForcedMoves()
+{
+    return DispatchPlayers<Set>(NumberOfPlayers, [&](auto players) { return PlayForcedMovesN<players()>(); });
+}
+
+template<typename Set, typename Rules>
+template<uint16_t N>
+uint16_t BasicDominoEngine<Set, Rules>::PlayForcedMovesN()
+{
+    uint16_t   played = 0;
+    DominoMove move;
+    while (!GameOver && GetForcedMove(move) && !move.IsDraw()) {
+        PlayMoveN<N>(move);
+        played++;
+    }
+    return played;
+}
+
+template<typename Set, typename Rules>
+void BasicDominoEngine<Set, Rules>::PlayMove(const DominoMove& move)
+{
+    DispatchPlayers<Set>(NumberOfPlayers, [&](auto players) { PlayMoveN<players()>(move); });
+}
+
+template<typename Set, typename Rules>
+template<uint16_t N>
+void BasicDominoEngine<Set, Rules>::PlayMoveN(const DominoMove& move)
+{
+    if constexpr (Rules::UsesBoneyard) {
+        // Drawing is part of the same turn, the player goes on until a tile fits or the boneyard runs out
+        if (move.IsDraw()) {
+            DrawTile(move.Tile);
+            if (!this->Boneyard && NobodyCanAttack<N>()) {
+                FindTheLowestSum<N>();
+                ScoreHand();
+                GameOver = true;
+            }
+            return;
+        }
+    }
+
+    if (move.IsPass()) {
+        TurnAdvance<N>();
+        NumberOfPasses++;
+        if (NumberOfPasses == N + 1) {
+            FindTheLowestSum<N>();
+            ScoreHand();
+            GameOver = true;
+        }
+        return;
+    }
+
+    const TileNumbers& T = Set::Tiles[move.Tile];
+    const bool first_tile = NoDominoesYet();
+    if (first_tile) {
+        LeftEnd  = T.Left;
+        RightEnd = T.Right;
+    }
+    else if (move.Side == EngineSide_Left) {
+        LeftEnd = T.Left == LeftEnd ? T.Right : T.Left;
+        if constexpr (Rules::UsesScores) {
+            this->LeftDouble = T.Left == T.Right;
+        }
+    }
+    else {
+        RightEnd = T.Left == RightEnd ? T.Right : T.Left;
+        if constexpr (Rules::UsesScores) {
+            this->RightDouble = T.Left == T.Right;
+        }
+    }
+    ScorePlay(move.Tile, first_tile);
+
+    Hands[CurrentTurn] &= ~TileBit<Mask>(move.Tile);
+    PlayedTiles        |= TileBit<Mask>(move.Tile);
+    RequiredTile        = NoTile;
+    NumberOfPasses      = 0;
+
+    // Check if the current player already won
+    if (!Hands[CurrentTurn]) {
+        PlayerWinner = CurrentTurn;
+        ScoreHand();
+        GameOver     = true;
+        return;
+    }
+
+    TurnAdvance<N>();
+
+    // A blocked game is over as soon as nobody holds a tile for the open ends, without a round of passes
+    if (NobodyCanAttack<N>()) {
+        FindTheLowestSum<N>();
+        ScoreHand();
+        GameOver = true;
+    }
+}
+
+template<typename Set, typename Rules>
+void BasicDominoEngine<Set, Rules>::MakeMove(const DominoMove& move, UndoRecord& undo)
+{
+    DispatchPlayers<Set>(NumberOfPlayers, [&](auto players) { MakeMoveN<players()>(move, undo); });
+}
+
+template<typename Set, typename Rules>
+template<uint16_t N>
+void BasicDominoEngine<Set, Rules>::MakeMoveN(const DominoMove& move, UndoRecord& undo)
+{
+    static_cast<RuleState&>(undo) = *this;
+    undo.Move           = move;
+    undo.Player         = CurrentTurn;
+    undo.NumberOfTurns  = NumberOfTurns;
+    undo.NumberOfPasses = NumberOfPasses;
+    undo.PlayerWinner   = PlayerWinner;
+    undo.LeftEnd        = LeftEnd;
+    undo.RightEnd       = RightEnd;
+    undo.RequiredTile   = RequiredTile;
+    undo.GameOver       = GameOver;
+    PlayMoveN<N>(move);
+}
+
+template<typename Set, typename Rules>
+void BasicDominoEngine<Set, Rules>::UnmakeMove(const UndoRecord& undo)
+{
+    const DominoMove& move = undo.Move;
+    if (move.Side == EngineSide_Left || move.Side == EngineSide_Right) {
+        Hands[undo.Player] |= TileBit<Mask>(move.Tile);
+        PlayedTiles        &= ~TileBit<Mask>(move.Tile);
+    }
+    if constexpr (Rules::UsesBoneyard) {
+        if (move.IsDraw()) {
+            // The drawn tile is the one that left the boneyard, a random draw included
+            Hands[undo.Player] &= ~(undo.Boneyard & ~this->Boneyard);
+        }
+    }
+
+    static_cast<RuleState&>(*this) = undo;
+    CurrentTurn    = undo.Player;
+    NumberOfTurns  = undo.NumberOfTurns;
+    NumberOfPasses = undo.NumberOfPasses;
+    PlayerWinner   = undo.PlayerWinner;
+    LeftEnd        = undo.LeftEnd;
+    RightEnd       = undo.RightEnd;
+    RequiredTile   = undo.RequiredTile;
+    GameOver       = undo.GameOver;
+}
+
+template<typename Set, typename Rules>
+template<uint16_t N>
+bool BasicDominoEngine<Set, Rules>::NobodyCanAttack() const
+{
+    if constexpr (Rules::UsesBoneyard) {
+        // Who draws the boneyard tiles changes the hands that are counted, the game goes on until it's empty
+        if (this->Boneyard) {
+            return false;
+        }
+    }
+
+    Mask held{};
+    for (uint16_t p = 0; p < N; p++) {
+        held |= Hands[p];
+    }
+    return !(held & (Set::PipTiles[LeftEnd] | Set::PipTiles[RightEnd]));
+}
+
+template<typename Set, typename Rules>
+bool BasicDominoEngine<Set, Rules>::IsGameOver() const
+{
+    return GameOver;
+}
+
+template<typename Set, typename Rules>
+bool BasicDominoEngine<Set, Rules>::NoDominoesYet() const
+{
+    return !PlayedTiles;
+}
+
+template<typename Set, typename Rules>
+uint16_t BasicDominoEngine<Set, Rules>::GetWinner() const
+{
+    return PlayerWinner;
+}
+
+template<typename Set, typename Rules>
+uint16_t BasicDominoEngine<Set, Rules>::GetNumberOfPlayers() const
+{
+    return NumberOfPlayers;
+}
+
+template<typename Set, typename Rules>
+uint16_t BasicDominoEngine<Set, Rules>::GetNumberOfCards() const
+{
+    return NumberOfCards;
+}
+
+template<typename Set, typename Rules>
+uint16_t BasicDominoEngine<Set, Rules>::GetCurrentTurn() const
+{
+    return CurrentTurn;
+}
+
+template<typename Set, typename Rules>
+uint16_t BasicDominoEngine<Set, Rules>::GetFirstTurn() const
+{
+    return FirstTurn;
+}
+
+template<typename Set, typename Rules>
+uint16_t BasicDominoEngine<Set, Rules>::GetNumberOfTurns() const
+{
+    return NumberOfTurns;
+}
+
+template<typename Set, typename Rules>
+uint16_t BasicDominoEngine<Set, Rules>::GetNumberOfPasses() const
+{
+    return NumberOfPasses;
+}
+
+template<typename Set, typename Rules>
+uint8_t BasicDominoEngine<Set, Rules>::GetLeftEnd() const
+{
+    return LeftEnd;
+}
+
+template<typename Set, typename Rules>
+uint8_t BasicDominoEngine<Set, Rules>::GetRightEnd() const
+{
+    return RightEnd;
+}
+
+template<typename Set, typename Rules>
+uint8_t BasicDominoEngine<Set, Rules>::GetRequiredTile() const
+{
+    return RequiredTile;
+}
+
+template<typename Set, typename Rules>
+typename Set::Mask BasicDominoEngine<Set, Rules>::GetHand(uint16_t player) const
+{
+    return Hands[player];
+}
+
+template<typename Set, typename Rules>
+typename Set::Mask BasicDominoEngine<Set, Rules>::GetPlayedTiles() const
+{
+    return PlayedTiles;
+}
+
+template<typename Set, typename Rules>
+typename Set::Mask BasicDominoEngine<Set, Rules>::GetBoneyard() const
+{
+    if constexpr (Rules::UsesBoneyard) {
+        return this->Boneyard;
+    }
+    else {
+        return Mask();
+    }
+}
+
+template<typename Set, typename Rules>
+uint16_t BasicDominoEngine<Set, Rules>::GetScore(uint16_t player) const
+{
+    if constexpr (Rules::UsesScores) {
+        return this->Scores[player];
+    }
+    else {
+        (void)player;
+        return 0;
+    }
+}
+
+template<typename Set, typename Rules>
+uint64_t BasicDominoEngine<Set, Rules>::GetHash() const
+{
+    const ZobristKeys<Set>& keys = Zobrist<Set>;
+
+    uint64_t hash = keys.LeftEnd[LeftEnd] ^ keys.RightEnd[RightEnd] ^ keys.Turn[CurrentTurn];
+    hash ^= MixBits(keys.Passes + NumberOfPasses) ^ MixBits(keys.Required + RequiredTile);
+    for (uint16_t p = 0; p < NumberOfPlayers; p++) {
+        for (Mask m = Hands[p]; m; m = WithoutLowestTile(m)) {
+            hash ^= keys.Tiles[p][LowestTile(m)];
+        }
+    }
+    if constexpr (Rules::UsesBoneyard) {
+        for (Mask m = this->Boneyard; m; m = WithoutLowestTile(m)) {
+            hash ^= keys.Tiles[Set::MaxPlayers][LowestTile(m)];
+        }
+    }
+    if constexpr (Rules::UsesScores) {
+        for (uint16_t p = 0; p < NumberOfPlayers; p++) {
+            hash ^= MixBits(keys.Score[p] + this->Scores[p]);
+        }
+        hash ^= MixBits(keys.Doubles + this->LeftDouble * 2 + this->RightDouble);
+    }
+    return hash;
+}
+
+template<typename Set, typename Rules>
+uint16_t BasicDominoEngine<Set, Rules>::RemainingCards(uint16_t player) const
+{
+    return static_cast<uint16_t>(CountTiles(Hands[player]));
+}
+
+template<typename Set, typename Rules>
+uint16_t BasicDominoEngine<Set, Rules>::SumOfCards(uint16_t player) const
+{
+    uint16_t sum = 0;
+    for (Mask m = Hands[player]; m; m = WithoutLowestTile(m)) {
+        const TileNumbers& T = Set::Tiles[LowestTile(m)];
+        sum += T.Left + T.Right;
+    }
+    return sum;
+}
+
+template class BasicDominoEngine<DoubleSix>;
+template class BasicDominoEngine<DoubleNine>;
+template class BasicDominoEngine<DoubleTwelve>;
+template class BasicDominoEngine<DoubleSix, DrawRules>;
+template class BasicDominoEngine<DoubleSix, AllFivesRules>;
+
+// The specialized PlayMove of every player count of every set, for the simulations dispatching on their own
+template void DominoEngine::PlayMoveN<4>(const DominoMove& move);
+template void DominoEngine::PlayMoveN<5>(const DominoMove& move);
+template void DominoEngine::PlayMoveN<6>(const DominoMove& move);
+template void DominoEngine::PlayMoveN<7>(const DominoMove& move);
+template void DominoEngine::PlayMoveN<8>(const DominoMove& move);
+template void BasicDominoEngine<DoubleNine>::PlayMoveN<4>(const DominoMove& move);
+template void BasicDominoEngine<DoubleNine>::PlayMoveN<5>(const DominoMove& move);
+template void BasicDominoEngine<DoubleNine>::PlayMoveN<6>(const DominoMove& move);
+template void BasicDominoEngine<DoubleNine>::PlayMoveN<7>(const DominoMove& move);
+template void BasicDominoEngine<DoubleNine>::PlayMoveN<8>(const DominoMove& move);
+template void BasicDominoEngine<DoubleNine>::PlayMoveN<9>(const DominoMove& move);
+template void BasicDominoEngine<DoubleNine>::PlayMoveN<10>(const DominoMove& move);
+template void BasicDominoEngine<DoubleNine>::PlayMoveN<11>(const DominoMove& move);
+template void BasicDominoEngine<DoubleNine>::PlayMoveN<12>(const DominoMove& move);
+template void BasicDominoEngine<DoubleTwelve>::PlayMoveN<4>(const DominoMove& move);
+template void BasicDominoEngine<DoubleTwelve>::PlayMoveN<5>(const DominoMove& move);
+template void BasicDominoEngine<DoubleTwelve>::PlayMoveN<6>(const DominoMove& move);
+template void BasicDominoEngine<DoubleTwelve>::PlayMoveN<7>(const DominoMove& move);
+template void BasicDominoEngine<DoubleTwelve>::PlayMoveN<8>(const DominoMove& move);
+template void BasicDominoEngine<DoubleTwelve>::PlayMoveN<9>(const DominoMove& move);
+template void BasicDominoEngine<DoubleTwelve>::PlayMoveN<10>(const DominoMove& move);
+template void BasicDominoEngine<DoubleTwelve>::PlayMoveN<11>(const DominoMove& move);
+template void BasicDominoEngine<DoubleTwelve>::PlayMoveN<12>(const DominoMove& move);
+template void BasicDominoEngine<DoubleTwelve>::PlayMoveN<13>(const DominoMove& move);
+template void BasicDominoEngine<DoubleTwelve>::PlayMoveN<14>(const DominoMove& move);
+template void BasicDominoEngine<DoubleTwelve>::PlayMoveN<15>(const DominoMove& move);
+template void BasicDominoEngine<DoubleTwelve>::PlayMoveN<16>(const DominoMove& move);
+template void BasicDominoEngine<DoubleSix, DrawRules>::PlayMoveN<4>(const DominoMove& move);
+template void BasicDominoEngine<DoubleSix, DrawRules>::PlayMoveN<5>(const DominoMove& move);
+template void BasicDominoEngine<DoubleSix, DrawRules>::PlayMoveN<6>(const DominoMove& move);
+template void BasicDominoEngine<DoubleSix, DrawRules>::PlayMoveN<7>(const DominoMove& move);
+template void BasicDominoEngine<DoubleSix, DrawRules>::PlayMoveN<8>(const DominoMove& move);
+template void BasicDominoEngine<DoubleSix, AllFivesRules>::PlayMoveN<4>(const DominoMove& move);
+template void BasicDominoEngine<DoubleSix, AllFivesRules>::PlayMoveN<5>(const DominoMove& move);
+template void BasicDominoEngine<DoubleSix, AllFivesRules>::PlayMoveN<6>(const DominoMove& move);
+template void BasicDominoEngine<DoubleSix, AllFivesRules>::PlayMoveN<7>(const DominoMove& move);
+template void BasicDominoEngine<DoubleSix, AllFivesRules>::PlayMoveN<8>(const DominoMove& move);
+
+// The specialized PlayForcedMoves of the double-six engines, for the searches
+template uint16_t DominoEngine::PlayForcedMovesN<4>();
+template uint16_t DominoEngine::PlayForcedMovesN<5>();
+template uint16_t DominoEngine::PlayForcedMovesN<6>();
+template uint16_t DominoEngine::PlayForcedMovesN<7>();
+template uint16_t DominoEngine::PlayForcedMovesN<8>();
+template uint16_t BasicDominoEngine<DoubleSix, DrawRules>::PlayForcedMovesN<4>();
+template uint16_t BasicDominoEngine<DoubleSix, DrawRules>::PlayForcedMovesN<5>();
+template uint16_t BasicDominoEngine<DoubleSix, DrawRules>::PlayForcedMovesN<6>();
+template uint16_t BasicDominoEngine<DoubleSix, DrawRules>::PlayForcedMovesN<7>();
+template uint16_t BasicDominoEngine<DoubleSix, DrawRules>::PlayForcedMovesN<8>();
+template uint16_t BasicDominoEngine<DoubleSix, AllFivesRules>::PlayForcedMovesN<4>();
+template uint16_t BasicDominoEngine<DoubleSix, AllFivesRules>::PlayForcedMovesN<5>();
+template uint16_t BasicDominoEngine<DoubleSix, AllFivesRules>::PlayForcedMovesN<6>();
+template uint16_t BasicDominoEngine<DoubleSix, AllFivesRules>::PlayForcedMovesN<7>();
+template uint16_t BasicDominoEngine<DoubleSix, AllFivesRules>::PlayForcedMovesN<8>();
+
+// The specialized MakeMove of every player count of every set, for the searches and the perft
+template void DominoEngine::MakeMoveN<4>(const DominoMove& move, UndoRecord& undo);
+template void DominoEngine::MakeMoveN<5>(const DominoMove& move, UndoRecord& undo);
+template void DominoEngine::MakeMoveN<6>(const DominoMove& move, UndoRecord& undo);
+template void DominoEngine::MakeMoveN<7>(const DominoMove& move, UndoRecord& undo);
+template void DominoEngine::MakeMoveN<8>(const DominoMove& move, UndoRecord& undo);
+template void BasicDominoEngine<DoubleNine>::MakeMoveN<4>(const DominoMove& move, UndoRecord& undo);
+template void BasicDominoEngine<DoubleNine>::MakeMoveN<5>(const DominoMove& move, UndoRecord& undo);
+template void BasicDominoEngine<DoubleNine>::MakeMoveN<6>(const DominoMove& move, UndoRecord& undo);
+template void BasicDominoEngine<DoubleNine>::MakeMoveN<7>(const DominoMove& move, UndoRecord& undo);
+template void BasicDominoEngine<DoubleNine>::MakeMoveN<8>(const DominoMove& move, UndoRecord& undo);
+template void BasicDominoEngine<DoubleNine>::MakeMoveN<9>(const DominoMove& move, UndoRecord& undo);
+template void BasicDominoEngine<DoubleNine>::MakeMoveN<10>(const DominoMove& move, UndoRecord& undo);
+template void BasicDominoEngine<DoubleNine>::MakeMoveN<11>(const DominoMove& move, UndoRecord& undo);
+template void BasicDominoEngine<DoubleNine>::MakeMoveN<12>(const DominoMove& move, UndoRecord& undo);
+template void BasicDominoEngine<DoubleTwelve>::MakeMoveN<4>(const DominoMove& move, UndoRecord& undo);
+template void BasicDominoEngine<DoubleTwelve>::MakeMoveN<5>(const DominoMove& move, UndoRecord& undo);
+template void BasicDominoEngine<DoubleTwelve>::MakeMoveN<6>(const DominoMove& move, UndoRecord& undo);
+template void BasicDominoEngine<DoubleTwelve>::MakeMoveN<7>(const DominoMove& move, UndoRecord& undo);
+template void BasicDominoEngine<DoubleTwelve>::MakeMoveN<8>(const DominoMove& move, UndoRecord& undo);
+template void BasicDominoEngine<DoubleTwelve>::MakeMoveN<9>(const DominoMove& move, UndoRecord& undo);
+template void BasicDominoEngine<DoubleTwelve>::MakeMoveN<10>(const DominoMove& move, UndoRecord& undo);
+template void BasicDominoEngine<DoubleTwelve>::MakeMoveN<11>(const DominoMove& move, UndoRecord& undo);
+template void BasicDominoEngine<DoubleTwelve>::MakeMoveN<12>(const DominoMove& move, UndoRecord& undo);
+template void BasicDominoEngine<DoubleTwelve>::MakeMoveN<13>(const DominoMove& move, UndoRecord& undo);
+template void BasicDominoEngine<DoubleTwelve>::MakeMoveN<14>(const DominoMove& move, UndoRecord& undo);
+template void BasicDominoEngine<DoubleTwelve>::MakeMoveN<15>(const DominoMove& move, UndoRecord& undo);
+template void BasicDominoEngine<DoubleTwelve>::MakeMoveN<16>(const DominoMove& move, UndoRecord& undo);
+template void BasicDominoEngine<DoubleSix, DrawRules>::MakeMoveN<4>(const DominoMove& move, UndoRecord& undo);
+template void BasicDominoEngine<DoubleSix, DrawRules>::MakeMoveN<5>(const DominoMove& move, UndoRecord& undo);
+template void BasicDominoEngine<DoubleSix, DrawRules>::MakeMoveN<6>(const DominoMove& move, UndoRecord& undo);
+template void BasicDominoEngine<DoubleSix, DrawRules>::MakeMoveN<7>(const DominoMove& move, UndoRecord& undo);
+template void BasicDominoEngine<DoubleSix, DrawRules>::MakeMoveN<8>(const DominoMove& move, UndoRecord& undo);
+template void BasicDominoEngine<DoubleSix, AllFivesRules>::MakeMoveN<4>(const DominoMove& move, UndoRecord& undo);
+template void BasicDominoEngine<DoubleSix, AllFivesRules>::MakeMoveN<5>(const DominoMove& move, UndoRecord& undo);
+template void BasicDominoEngine<DoubleSix, AllFivesRules>::MakeMoveN<6>(const DominoMove& move, UndoRecord& undo);
+template void BasicDominoEngine<DoubleSix, AllFivesRules>::MakeMoveN<7>(const DominoMove& move, UndoRecord& undo);
+template void BasicDominoEngine<DoubleSix, AllFivesRules>::MakeMoveN<8>(const DominoMove& move, UndoRecord& undo);
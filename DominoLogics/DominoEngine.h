@@ -0,0 +1,552 @@
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <random>
+#include <type_traits>
+#include <utility>
+
+//-----------------------------------------------------------------------------------------------------------------------
+// Headless game rules.
+// Tiles are referred by their index in the canonical domino order (the order dvars::GameDominoes is declared with)
+// and hands are bitmasks of those indices, so a whole game fits in a few cache lines and can be copied, simulated
+// and searched without touching the UI.
+// The rules are written for any domino set up to double-twelve. DominoEngine and the dengine constants are the
+// double-six set the game is played with.
+//-----------------------------------------------------------------------------------------------------------------------
+
+namespace dengine
+{
+constexpr uint8_t  NoTile   = 0xFF;
+constexpr uint16_t MaxCards = 8;      // Highest number of cards a deal can give
+constexpr uint16_t MaxMoves = 26;     // Both open ends taking the 13 tiles of their pip of a double-twelve set
+
+struct TileNumbers
+{
+	uint8_t Left;
+	uint8_t Right;
+};
+
+// Tile mask of the double-twelve set. The bitwise operations on the two words are vectorized by the compiler on the
+// targets with 128-bit registers
+struct TileMask128
+{
+	uint64_t Low  = 0;
+	uint64_t High = 0;
+
+	constexpr TileMask128() = default;
+	constexpr TileMask128(uint64_t low, uint64_t high = 0) : Low(low), High(high) {}
+
+	constexpr TileMask128 operator & (const TileMask128& o) const { return TileMask128(Low & o.Low, High & o.High); }
+	constexpr TileMask128 operator | (const TileMask128& o) const { return TileMask128(Low | o.Low, High | o.High); }
+	constexpr TileMask128 operator ^ (const TileMask128& o) const { return TileMask128(Low ^ o.Low, High ^ o.High); }
+	constexpr TileMask128 operator ~ () const { return TileMask128(~Low, ~High); }
+	constexpr TileMask128& operator &= (const TileMask128& o) { Low &= o.Low; High &= o.High; return *this; }
+	constexpr TileMask128& operator |= (const TileMask128& o) { Low |= o.Low; High |= o.High; return *this; }
+	constexpr explicit operator bool () const { return (Low | High) != 0; }
+	constexpr bool operator == (const TileMask128& o) const = default;
+};
+
+// Mask operations shared by the 32, 64 and 128-bit tile masks
+template<typename Mask>
+constexpr Mask TileBit(uint16_t tile)
+{
+	if constexpr (std::is_same_v<Mask, TileMask128>) {
+		return tile < 64 ? TileMask128(uint64_t(1) << tile, 0) : TileMask128(0, uint64_t(1) << (tile - 64));
+	}
+	else {
+		return Mask(1) << tile;
+	}
+}
+
+template<typename Mask>
+constexpr int CountTiles(const Mask& mask)
+{
+	if constexpr (std::is_same_v<Mask, TileMask128>) {
+		return std::popcount(mask.Low) + std::popcount(mask.High);
+	}
+	else {
+		return std::popcount(mask);
+	}
+}
+
+// Index of the lowest tile of a non empty mask
+template<typename Mask>
+constexpr uint8_t LowestTile(const Mask& mask)
+{
+	if constexpr (std::is_same_v<Mask, TileMask128>) {
+		return static_cast<uint8_t>(mask.Low != 0 ? std::countr_zero(mask.Low) : 64 + std::countr_zero(mask.High));
+	}
+	else {
+		return static_cast<uint8_t>(std::countr_zero(mask));
+	}
+}
+
+template<typename Mask>
+constexpr Mask WithoutLowestTile(const Mask& mask)
+{
+	if constexpr (std::is_same_v<Mask, TileMask128>) {
+		return mask.Low != 0 ? TileMask128(mask.Low & (mask.Low - 1), mask.High) : TileMask128(0, mask.High & (mask.High - 1));
+	}
+	else {
+		return mask & (mask - 1);
+	}
+}
+
+//-----------------------------------------------------------------------------------------------------------------------
+// DominoSet TRAITS
+//-----------------------------------------------------------------------------------------------------------------------
+
+// A domino set from (1|0) to (Pips|Pips). Like the game's double-six set, the (0|0) tile is not part of it
+template<uint16_t Pips>
+struct DominoSet
+{
+	static constexpr uint16_t HighestPip    = Pips;
+	static constexpr uint16_t NumberOfTiles = (Pips + 1) * (Pips + 2) / 2 - 1;
+	static constexpr uint16_t MinPlayers    = 4;
+	static constexpr uint16_t MaxPlayers    = Pips <= 6 ? 8 : (Pips <= 9 ? 12 : 16);
+
+	using Mask = std::conditional_t<NumberOfTiles <= 32, uint32_t, std::conditional_t<NumberOfTiles <= 64, uint64_t, TileMask128>>;
+
+	// The canonical tile order, (1|0) ... (Pips|0), (1|1) ... (Pips|Pips). For double-six it is the order
+	// dvars::GameDominoes is declared with
+	static constexpr std::array<TileNumbers, NumberOfTiles> MakeTileTable()
+	{
+		std::array<TileNumbers, NumberOfTiles> table{};
+		for (int i = 0, low = 0; low <= HighestPip; low++) {
+			for (int high = low == 0 ? 1 : low; high <= HighestPip; high++) {
+				table[i].Left  = static_cast<uint8_t>(high);
+				table[i].Right = static_cast<uint8_t>(low);
+				i++;
+			}
+		}
+		return table;
+	}
+
+	static constexpr std::array<TileNumbers, NumberOfTiles> Tiles = MakeTileTable();
+
+	// Mask of every tile that has the pip number on any of its side
+	static constexpr std::array<Mask, HighestPip + 1> MakePipTileMasks()
+	{
+		std::array<Mask, HighestPip + 1> masks{};
+		for (int i = 0; i < NumberOfTiles; i++) {
+			masks[Tiles[i].Left]  |= TileBit<Mask>(i);
+			masks[Tiles[i].Right] |= TileBit<Mask>(i);
+		}
+		return masks;
+	}
+
+	static constexpr std::array<Mask, HighestPip + 1> PipTiles = MakePipTileMasks();
+
+	// Returns the canonical index of the tile with the given numbers in any order. NoTile if there is no such tile (0|0)
+	static constexpr uint8_t TileIndex(uint16_t num1, uint16_t num2)
+	{
+		const uint16_t high = num1 > num2 ? num1 : num2;
+		const uint16_t low  = num1 > num2 ? num2 : num1;
+		if (high == 0 || high > HighestPip) {
+			return NoTile;
+		}
+		// Tiles before the low number's group, minus the missing (0|0), plus the offset in the group
+		const uint16_t group_start = low == 0 ? 0 : low * (HighestPip + 1) - low * (low - 1) / 2 - 1;
+		return static_cast<uint8_t>(group_start + high - (low == 0 ? 1 : low));
+	}
+
+	// Number of cards each player is dealt. The double-six rule is the same as DominoGameStructure::InitializeGame,
+	// bigger sets deal about three quarters of the tiles
+	static constexpr uint16_t CardsPerPlayer(uint16_t number_of_players)
+	{
+		if constexpr (Pips == 6) {
+			return number_of_players == 4 ? 5 : (number_of_players > 6 ? 3 : 4);
+		}
+		else {
+			const uint16_t cards = static_cast<uint16_t>(NumberOfTiles * 3 / 4 / number_of_players);
+			return cards > 7 ? 7 : cards;
+		}
+	}
+
+	// The tile the first turn player opens with among the given tiles: the highest double, or the highest tile if
+	// there are no doubles. NoTile if there are no tiles
+	static constexpr uint8_t OpeningTile(const Mask& tiles)
+	{
+		for (int i = HighestPip; i > 0; i--) {
+			if (tiles & TileBit<Mask>(TileIndex(i, i))) {
+				return TileIndex(i, i);
+			}
+		}
+		for (int i = HighestPip; i > 0; i--) {
+			for (int j = i - 1; j >= 0; j--) {
+				if (tiles & TileBit<Mask>(TileIndex(i, j))) {
+					return TileIndex(i, j);
+				}
+			}
+		}
+		return NoTile;
+	}
+};
+
+using DoubleSix    = DominoSet<6>;
+using DoubleNine   = DominoSet<9>;
+using DoubleTwelve = DominoSet<12>;
+
+//-----------------------------------------------------------------------------------------------------------------------
+// Zobrist keys
+//-----------------------------------------------------------------------------------------------------------------------
+
+// Finalizer of splitmix64, a well mixed 64-bit value for any input
+constexpr uint64_t MixBits(uint64_t x)
+{
+	x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ull;
+	x = (x ^ (x >> 27)) * 0x94D049BB133111EBull;
+	return x ^ (x >> 31);
+}
+
+// Random keys of everything a position is made of. The hash of a position is the XOR of the keys of its parts, so
+// the same position reached through different move orders gets the same hash
+template<typename Set>
+struct ZobristKeys
+{
+	std::array<std::array<uint64_t, Set::NumberOfTiles>, Set::MaxPlayers + 1> Tiles{};   // By owner, the boneyard last
+	std::array<uint64_t, Set::HighestPip + 1> LeftEnd{};
+	std::array<uint64_t, Set::HighestPip + 1> RightEnd{};
+	std::array<uint64_t, Set::MaxPlayers>     Turn{};
+	std::array<uint64_t, Set::MaxPlayers>     Score{};    // Mixed with the score instead of a key per score
+	uint64_t                                  Passes   = 0;
+	uint64_t                                  Required = 0;
+	uint64_t                                  Doubles  = 0;
+
+	static constexpr ZobristKeys Make()
+	{
+		ZobristKeys keys;
+		uint64_t    n = 0;
+		for (auto& owner : keys.Tiles) {
+			for (auto& key : owner) {
+				key = MixBits(++n);
+			}
+		}
+		for (int i = 0; i <= Set::HighestPip; i++) {
+			keys.LeftEnd[i]  = MixBits(++n);
+			keys.RightEnd[i] = MixBits(++n);
+		}
+		for (int p = 0; p < Set::MaxPlayers; p++) {
+			keys.Turn[p]  = MixBits(++n);
+			keys.Score[p] = MixBits(++n);
+		}
+		keys.Passes   = MixBits(++n);
+		keys.Required = MixBits(++n);
+		keys.Doubles  = MixBits(++n);
+		return keys;
+	}
+};
+
+template<typename Set>
+inline constexpr ZobristKeys<Set> Zobrist = ZobristKeys<Set>::Make();
+
+//-----------------------------------------------------------------------------------------------------------------------
+// Rule variants.
+// The engine takes one as a template argument and derives from its State, so a variant only compiles in the state
+// and the steps it needs and the block game pays nothing for the others.
+// The game itself only plays BlockRules, DominoGameStructure has no boneyard or scores. The draw and All Fives games
+// are played by the engine, the bots and the searches through the tools: Perft and MatchRunner with --rules, and
+// RulesBenchmark.
+//-----------------------------------------------------------------------------------------------------------------------
+
+template<typename Set>
+struct NoRuleState {};
+
+template<typename Set>
+struct BoneyardState
+{
+	typename Set::Mask Boneyard{};
+	uint64_t           DrawState = 0;     // Random state of the draws that don't say which tile is drawn
+};
+
+template<typename Set>
+struct ScoringState : BoneyardState<Set>
+{
+	std::array<uint16_t, Set::MaxPlayers> Scores{};
+	bool                                  LeftDouble  = false;   // A double lies across the end, both halves count
+	bool                                  RightDouble = false;
+};
+
+// The game's block rules, the same as DominoGameStructure: only the dealt tiles are played and a player that can't
+// attack passes
+struct BlockRules
+{
+	template<typename Set>
+	using State = NoRuleState<Set>;
+
+	static constexpr bool        UsesBoneyard = false;
+	static constexpr bool        UsesScores   = false;
+	static constexpr const char* Name         = "block";
+};
+
+// The tiles left after the deal are the boneyard. A player that can't attack draws until a tile fits, and only passes
+// once the boneyard is empty
+struct DrawRules
+{
+	template<typename Set>
+	using State = BoneyardState<Set>;
+
+	static constexpr bool        UsesBoneyard = true;
+	static constexpr bool        UsesScores   = false;
+	static constexpr const char* Name         = "draw";
+};
+
+// All Fives, the draw game where a play leaving the open ends adding up to a multiple of 5 scores that sum. The player
+// that ends the hand scores the pips left in the other hands rounded to 5, and the highest score wins the game
+struct AllFivesRules
+{
+	template<typename Set>
+	using State = ScoringState<Set>;
+
+	static constexpr bool        UsesBoneyard = true;
+	static constexpr bool        UsesScores   = true;
+	static constexpr const char* Name         = "allfives";
+
+	static constexpr uint16_t PlayPoints(uint16_t ends_sum) { return ends_sum % 5 == 0 ? ends_sum : 0; }
+	static constexpr uint16_t HandPoints(uint16_t pips) { return (pips + 2) / 5 * 5; }
+};
+
+// The double-six set of the game
+constexpr uint16_t MinPlayers    = DoubleSix::MinPlayers;
+constexpr uint16_t MaxPlayers    = DoubleSix::MaxPlayers;
+constexpr uint16_t NumberOfTiles = DoubleSix::NumberOfTiles;
+constexpr uint16_t HighestPip    = DoubleSix::HighestPip;
+
+using TileMask = DoubleSix::Mask;
+
+inline constexpr const std::array<TileNumbers, NumberOfTiles>& Tiles    = DoubleSix::Tiles;
+inline constexpr const std::array<TileMask, HighestPip + 1>&   PipTiles = DoubleSix::PipTiles;
+
+constexpr uint8_t TileIndex(uint16_t num1, uint16_t num2)
+{
+	return DoubleSix::TileIndex(num1, num2);
+}
+
+constexpr bool IsDoubleTile(uint8_t tile)
+{
+	return Tiles[tile].Left == Tiles[tile].Right;
+}
+
+constexpr uint16_t TileSum(uint8_t tile)
+{
+	return Tiles[tile].Left + Tiles[tile].Right;
+}
+
+constexpr uint8_t OpeningTile(TileMask tiles)
+{
+	return DoubleSix::OpeningTile(tiles);
+}
+
+constexpr uint16_t CardsPerPlayer(uint16_t number_of_players)
+{
+	return DoubleSix::CardsPerPlayer(number_of_players);
+}
+
+// Compile-time number of players. Code templated on it gets fixed trip counts and turn rotations
+template<uint16_t N>
+using PlayerCount = std::integral_constant<uint16_t, N>;
+
+template<uint16_t First, typename Function, uint16_t... Offsets>
+constexpr auto MakePlayerDispatchTable(std::integer_sequence<uint16_t, Offsets...>)
+{
+	using Result = decltype(std::declval<Function&>()(PlayerCount<First>{}));
+	return std::array<Result (*)(Function&), sizeof...(Offsets)>{
+		[](Function& function) -> Result { return function(PlayerCount<First + Offsets>{}); }...
+	};
+}
+
+// Calls function(PlayerCount<N>{}) through a table of the specializations for every player count of the set, so a
+// whole game or search can run the code compiled for its number of players after a single indirect call
+template<typename Set = DoubleSix, typename Function>
+decltype(auto) DispatchPlayers(uint16_t number_of_players, Function&& function)
+{
+	static constexpr auto Table = MakePlayerDispatchTable<Set::MinPlayers, std::remove_reference_t<Function>>(
+		std::make_integer_sequence<uint16_t, Set::MaxPlayers - Set::MinPlayers + 1>{});
+	return Table[number_of_players - Set::MinPlayers](function);
+}
+
+}
+
+enum AIDifficulty_
+{
+	AIDifficulty_Random,
+	AIDifficulty_Normal,
+	AIDifficulty_Hard,
+	AIDifficulty_GigaBrain
+};
+
+enum EngineSide_
+{
+	EngineSide_Left  = 0, // The same as TileDropPosition_Left
+	EngineSide_Right = 1, // The same as TileDropPosition_Right
+	EngineSide_Pass  = 2,
+	EngineSide_Draw  = 3  // Draws a tile from the boneyard. A random one if the move's tile is NoTile
+};
+
+struct DominoMove
+{
+	uint8_t Tile = dengine::NoTile;
+	uint8_t Side = EngineSide_Pass;
+
+	DominoMove() = default;
+	constexpr DominoMove(uint8_t tile, uint8_t side) : Tile(tile), Side(side) {}
+
+	constexpr bool IsPass() const { return Side == EngineSide_Pass; }
+	constexpr bool IsDraw() const { return Side == EngineSide_Draw; }
+	constexpr bool operator == (const DominoMove& other) const = default;
+};
+
+// Fixed capacity move list. Only the tiles of the open ends' pips can be attacked, each on at most 2 sides
+struct DominoMoveList
+{
+	std::array<DominoMove, dengine::MaxMoves> Moves;
+	uint16_t                                  Size = 0;
+
+	void Clear() { Size = 0; }
+	void Add(const DominoMove& m) { Moves[Size++] = m; }
+	const DominoMove* begin() const { return Moves.data(); }
+	const DominoMove* end() const { return Moves.data() + Size; }
+	const DominoMove& operator [] (size_t i) const { return Moves[i]; }
+};
+
+
+
+//-----------------------------------------------------------------------------------------------------------------------
+// BasicDominoEngine CLASS
+//-----------------------------------------------------------------------------------------------------------------------
+
+template<typename Set, typename Rules = dengine::BlockRules>
+class BasicDominoEngine : private Rules::template State<Set>
+{
+public:
+	using TileSet   = Set;
+	using RuleSet   = Rules;
+	using Mask      = typename Set::Mask;
+	using RuleState = typename Rules::template State<Set>;
+
+	// What MakeMove changes besides the moving hand and the played tiles, which UnmakeMove gets back from the move.
+	// The rule state is kept whole: nothing for the block game, the boneyard (and the drawn tile with it) and the
+	// scores for the others
+	struct UndoRecord : RuleState
+	{
+		uint16_t   Player;
+		uint16_t   NumberOfTurns;
+		uint16_t   NumberOfPasses;
+		uint16_t   PlayerWinner;
+		uint8_t    LeftEnd;
+		uint8_t    RightEnd;
+		uint8_t    RequiredTile;
+		bool       GameOver;
+		DominoMove Move;
+	};
+
+private:
+	std::array<Mask, Set::MaxPlayers> Hands;
+	Mask              PlayedTiles;
+	uint16_t          NumberOfPlayers;
+	uint16_t          NumberOfCards;
+	uint16_t          FirstTurn;
+	uint16_t          CurrentTurn;         // CurrentTurn to GameOver is what a move changes, see UndoRecord
+	uint16_t          NumberOfTurns;
+	uint16_t          NumberOfPasses;
+	uint16_t          PlayerWinner;
+	uint8_t           LeftEnd;
+	uint8_t           RightEnd;
+	uint8_t           RequiredTile;        // The tile the first turn player must open with. NoTile if any tile can be used
+	bool              GameOver;
+
+public:
+	BasicDominoEngine();
+
+	// Shuffles and deals a new game the same way DominoGameStructure::DistributeCards does.
+	// The first turn player is found with the highest double/highest tile rule unless first_turn is given.
+	// number_of_cards overrides the set's CardsPerPlayer rule, up to dengine::MaxCards
+	void NewGame(uint16_t number_of_players, uint32_t seed, int first_turn = -1, uint16_t number_of_cards = 0);
+	// Starts the game with the hands given with GiveTile, finding the first turn player the same way NewGame does
+	void StartGame(int first_turn = -1);
+
+	// Position setup, used to mirror a game that is not dealt by the engine (e.g. the one on the UI)
+	void ClearPosition(uint16_t number_of_players, uint16_t number_of_cards = 0);
+	void GiveTile(uint16_t player, uint8_t tile);
+	void SetPlayedTile(uint8_t tile);
+	void SetBoardEnds(uint8_t left_end, uint8_t right_end);
+	void SetTurns(uint16_t current_turn, uint16_t first_turn, uint16_t number_of_turns);
+	void SetNumberOfPasses(uint16_t passes);
+	void SetRequiredTile(uint8_t tile);
+	// Replace the hidden tiles of a position, e.g. with a sampled deal of what a player can't see.
+	// SetBoneyard does nothing when the rules have no boneyard
+	void SetHand(uint16_t player, Mask hand);
+	void SetBoneyard(Mask boneyard);
+
+	// Fills the list with the legal moves of the current player. A single draw move if there are no possible attacks
+	// and the rules have a boneyard with tiles left, a single pass move otherwise
+	void GenerateMoves(DominoMoveList& moves) const;
+	bool CurrentPlayerCanAttack() const;
+	bool IsLegalMove(const DominoMove& move) const;
+	// The only move of the current player: a pass, a draw or a single usable tile. A tile that fits both open ends
+	// still counts as forced when they show the same pip, both sides give the same game. False if there is a choice
+	bool GetForcedMove(DominoMove& move) const;
+	void PlayMove(const DominoMove& move);
+	// PlayMove specialized for N players. N must be the number of players of the game
+	template<uint16_t N>
+	void PlayMoveN(const DominoMove& move);
+	// Plays the forced moves until a player has a choice, has to draw or the game is over. Draws are left to the
+	// caller since the drawn tile is a chance event. Returns the number of moves played
+	uint16_t PlayForcedMoves();
+	template<uint16_t N>
+	uint16_t PlayForcedMovesN();
+	// PlayMove that can be taken back with UnmakeMove, so a search can walk the tree on a single engine. The moves
+	// must be unmade in the reverse order they were made
+	void MakeMove(const DominoMove& move, UndoRecord& undo);
+	template<uint16_t N>
+	void MakeMoveN(const DominoMove& move, UndoRecord& undo);
+	void UnmakeMove(const UndoRecord& undo);
+
+	bool              IsGameOver() const;
+	bool              NoDominoesYet() const;
+	uint16_t          GetWinner() const;
+	uint16_t          GetNumberOfPlayers() const;
+	uint16_t          GetNumberOfCards() const;
+	uint16_t          GetCurrentTurn() const;
+	uint16_t          GetFirstTurn() const;
+	uint16_t          GetNumberOfTurns() const;
+	uint16_t          GetNumberOfPasses() const;
+	uint8_t           GetLeftEnd() const;
+	uint8_t           GetRightEnd() const;
+	uint8_t           GetRequiredTile() const;
+	Mask              GetHand(uint16_t player) const;
+	Mask              GetPlayedTiles() const;
+	uint16_t          RemainingCards(uint16_t player) const;
+	uint16_t          SumOfCards(uint16_t player) const;
+	// Empty and 0 when the rules have no boneyard or no scores
+	Mask              GetBoneyard() const;
+	uint16_t          GetScore(uint16_t player) const;
+	// Zobrist hash of everything that decides how the game goes on: the hands, the boneyard, the open ends, the turn,
+	// the passes and the scores. Computed from scratch, every hand's tiles included
+	uint64_t          GetHash() const;
+
+private:
+	void DistributeCards(uint32_t seed);
+	void DrawTile(uint8_t tile);
+	void ScorePlay(uint8_t tile, bool first_tile);
+	void ScoreHand();
+	void FindFirstPlayerTurn();
+	template<uint16_t N>
+	void FindTheLowestSum();
+	// No hand has a tile for the open ends and no draw can change that
+	template<uint16_t N>
+	bool NobodyCanAttack() const;
+	template<uint16_t N>
+	void TurnAdvance();
+};
+
+// The game's double-six block engine
+using DominoEngine = BasicDominoEngine<dengine::DoubleSix>;
+
+extern template class BasicDominoEngine<dengine::DoubleSix>;
+extern template class BasicDominoEngine<dengine::DoubleNine>;
+extern template class BasicDominoEngine<dengine::DoubleTwelve>;
+extern template class BasicDominoEngine<dengine::DoubleSix, dengine::DrawRules>;
+extern template class BasicDominoEngine<dengine::DoubleSix, dengine::AllFivesRules>;
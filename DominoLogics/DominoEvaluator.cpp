@@ -0,0 +1,258 @@
+#include "DominoEvaluator.h"
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <string>
+
+using namespace dengine;
+
+namespace
+{
+const char* FeatureNames[EvalFeature_COUNT] = {
+    "Bias", "RemainingCards", "SumOfCards", "FewestOpponentCards", "CardLead", "PlayableTiles",
+    "UnseenEndTiles", "DistinctPips", "Doubles", "PipControl", "TurnDistance", "Progress"
+};
+
+float Sigmoid(float x)
+{
+    return 1.0f / (1.0f + std::exp(-x));
+}
+}
+
+//-----------------------------------------------------------------------------------------------------------------------
+// DominoEvaluator CLASS
+//-----------------------------------------------------------------------------------------------------------------------
+
+DominoEvaluator::DominoEvaluator() :
+    Weights(DefaultWeights())
+{}
+
+EvalWeights DominoEvaluator::DefaultWeights()
+{
+    // Fitted with DominoTools/SelfPlayTrainer.cpp
+    return {
+        -2.24f,  // Bias
+        -1.79f,  // RemainingCards
+        -0.66f,  // SumOfCards
+         2.07f,  // FewestOpponentCards
+         6.10f,  // CardLead
+         1.54f,  // PlayableTiles
+        -0.74f,  // UnseenEndTiles
+         2.13f,  // DistinctPips
+        -1.07f,  // Doubles
+         1.51f,  // PipControl
+        -1.93f,  // TurnDistance
+         0.95f   // Progress
+    };
+}
+
+void DominoEvaluator::ExtractFeatures(const DominoEngine& engine, uint16_t player, EvalFeatures& features)
+{
+    DispatchPlayers(engine.GetNumberOfPlayers(), [&](auto players) { ExtractFeatures<players()>(engine, player, features); });
+}
+
+template<uint16_t N, typename Engine>
+void DominoEvaluator::ExtractFeatures(const Engine& engine, uint16_t player, EvalFeatures& features)
+{
+    const float    dealt_cards       = static_cast<float>(engine.GetNumberOfCards());
+    const TileMask hand              = engine.GetHand(player);
+    const TileMask unseen            = ((TileMask(1) << NumberOfTiles) - 1) & ~hand & ~engine.GetPlayedTiles();
+    const float    own_cards         = static_cast<float>(engine.RemainingCards(player));
+
+    uint16_t fewest_opponent_cards = UINT16_MAX;
+    uint16_t opponent_cards        = 0;
+    for (uint16_t p = 0; p < N; p++) {
+        if (p == player) {
+            continue;
+        }
+        const uint16_t cards  = engine.RemainingCards(p);
+        fewest_opponent_cards = std::min(fewest_opponent_cards, cards);
+        opponent_cards       += cards;
+    }
+
+    TileMask end_tiles = 0;
+    if (!engine.NoDominoesYet()) {
+        end_tiles = PipTiles[engine.GetLeftEnd()] | PipTiles[engine.GetRightEnd()];
+    }
+
+    uint16_t distinct_pips = 0;
+    uint16_t pip_control   = 0;
+    for (uint16_t pip = 0; pip <= HighestPip; pip++) {
+        const int own = std::popcount(hand & PipTiles[pip]);
+        distinct_pips += own > 0;
+        pip_control   += own > 0 && own >= std::popcount(unseen & PipTiles[pip]);
+    }
+
+    uint16_t doubles = 0;
+    for (TileMask m = hand; m; m &= m - 1) {
+        doubles += IsDoubleTile(static_cast<uint8_t>(std::countr_zero(m)));
+    }
+
+    const uint16_t turn_distance = (player + N - engine.GetCurrentTurn()) % N;
+
+    features[EvalFeature_Bias]                = 1.0f;
+    features[EvalFeature_RemainingCards]      = own_cards / dealt_cards;
+    features[EvalFeature_SumOfCards]          = engine.SumOfCards(player) / (12.0f * dealt_cards);
+    features[EvalFeature_FewestOpponentCards] = fewest_opponent_cards / dealt_cards;
+    features[EvalFeature_CardLead]            = (opponent_cards / static_cast<float>(N - 1) - own_cards) / dealt_cards;
+    features[EvalFeature_PlayableTiles]       = std::popcount(hand & end_tiles) / dealt_cards;
+    features[EvalFeature_UnseenEndTiles]      = std::popcount(unseen & end_tiles) / 12.0f;
+    features[EvalFeature_DistinctPips]        = distinct_pips / 7.0f;
+    features[EvalFeature_Doubles]             = doubles / dealt_cards;
+    features[EvalFeature_PipControl]          = pip_control / 7.0f;
+    features[EvalFeature_TurnDistance]        = turn_distance / static_cast<float>(N);
+    features[EvalFeature_Progress]            = std::popcount(engine.GetPlayedTiles()) / (dealt_cards * N);
+}
+
+float DominoEvaluator::EvaluateFeatures(const EvalFeatures& features) const
+{
+    float sum = 0.0f;
+    for (int i = 0; i < EvalFeature_COUNT; i++) {
+        sum += features[i] * Weights[i];
+    }
+    return Sigmoid(sum);
+}
+
+float DominoEvaluator::Evaluate(const DominoEngine& engine, uint16_t player) const
+{
+    return DispatchPlayers(engine.GetNumberOfPlayers(), [&](auto players) { return Evaluate<players()>(engine, player); });
+}
+
+template<uint16_t N, typename Engine>
+float DominoEvaluator::Evaluate(const Engine& engine, uint16_t player) const
+{
+    if (engine.IsGameOver()) {
+        return engine.GetWinner() == player ? 1.0f : 0.0f;
+    }
+
+    EvalFeatures features;
+    ExtractFeatures<N>(engine, player, features);
+    return EvaluateFeatures(features);
+}
+
+DominoMove DominoEvaluator::SelectMove(const DominoEngine& engine, std::mt19937& rng, float explore) const
+{
+    return DispatchPlayers(engine.GetNumberOfPlayers(), [&](auto players) { return SelectMove<players()>(engine, rng, explore); });
+}
+
+template<uint16_t N, typename Engine>
+DominoMove DominoEvaluator::SelectMove(const Engine& engine, std::mt19937& rng, float explore) const
+{
+    DominoMoveList moves;
+    engine.GenerateMoves(moves);
+    if (moves.Size == 1) {
+        return moves[0];
+    }
+
+    if (explore > 0.0f && std::uniform_real_distribution<float>(0.0f, 1.0f)(rng) < explore) {
+        return moves[std::uniform_int_distribution<uint16_t>(0, moves.Size - 1)(rng)];
+    }
+
+    const uint16_t player     = engine.GetCurrentTurn();
+    DominoMove     best_move  = moves[0];
+    float          best_score = -1.0f;
+    for (const auto& move : moves) {
+        Engine next = engine;
+        next.template PlayMoveN<N>(move);
+
+        const float score = Evaluate<N>(next, player);
+        if (score > best_score) {
+            best_score = score;
+            best_move  = move;
+        }
+    }
+
+    return best_move;
+}
+
+// The player count specializations of every double-six rule variant, for the searches and bots dispatching on their own
+template float DominoEvaluator::Evaluate<4>(const DominoEngine& engine, uint16_t player) const;
+template float DominoEvaluator::Evaluate<5>(const DominoEngine& engine, uint16_t player) const;
+template float DominoEvaluator::Evaluate<6>(const DominoEngine& engine, uint16_t player) const;
+template float DominoEvaluator::Evaluate<7>(const DominoEngine& engine, uint16_t player) const;
+template float DominoEvaluator::Evaluate<8>(const DominoEngine& engine, uint16_t player) const;
+template float DominoEvaluator::Evaluate<4>(const BasicDominoEngine<DoubleSix, DrawRules>& engine, uint16_t player) const;
+template float DominoEvaluator::Evaluate<5>(const BasicDominoEngine<DoubleSix, DrawRules>& engine, uint16_t player) const;
+template float DominoEvaluator::Evaluate<6>(const BasicDominoEngine<DoubleSix, DrawRules>& engine, uint16_t player) const;
+template float DominoEvaluator::Evaluate<7>(const BasicDominoEngine<DoubleSix, DrawRules>& engine, uint16_t player) const;
+template float DominoEvaluator::Evaluate<8>(const BasicDominoEngine<DoubleSix, DrawRules>& engine, uint16_t player) const;
+template float DominoEvaluator::Evaluate<4>(const BasicDominoEngine<DoubleSix, AllFivesRules>& engine, uint16_t player) const;
+template float DominoEvaluator::Evaluate<5>(const BasicDominoEngine<DoubleSix, AllFivesRules>& engine, uint16_t player) const;
+template float DominoEvaluator::Evaluate<6>(const BasicDominoEngine<DoubleSix, AllFivesRules>& engine, uint16_t player) const;
+template float DominoEvaluator::Evaluate<7>(const BasicDominoEngine<DoubleSix, AllFivesRules>& engine, uint16_t player) const;
+template float DominoEvaluator::Evaluate<8>(const BasicDominoEngine<DoubleSix, AllFivesRules>& engine, uint16_t player) const;
+template DominoMove DominoEvaluator::SelectMove<4>(const DominoEngine& engine, std::mt19937& rng, float explore) const;
+template DominoMove DominoEvaluator::SelectMove<5>(const DominoEngine& engine, std::mt19937& rng, float explore) const;
+template DominoMove DominoEvaluator::SelectMove<6>(const DominoEngine& engine, std::mt19937& rng, float explore) const;
+template DominoMove DominoEvaluator::SelectMove<7>(const DominoEngine& engine, std::mt19937& rng, float explore) const;
+template DominoMove DominoEvaluator::SelectMove<8>(const DominoEngine& engine, std::mt19937& rng, float explore) const;
+template DominoMove DominoEvaluator::SelectMove<4>(const BasicDominoEngine<DoubleSix, DrawRules>& engine, std::mt19937& rng, float explore) const;
+template DominoMove DominoEvaluator::SelectMove<5>(const BasicDominoEngine<DoubleSix, DrawRules>& engine, std::mt19937& rng, float explore) const;
+template DominoMove DominoEvaluator::SelectMove<6>(const BasicDominoEngine<DoubleSix, DrawRules>& engine, std::mt19937& rng, float explore) const;
+template DominoMove DominoEvaluator::SelectMove<7>(const BasicDominoEngine<DoubleSix, DrawRules>& engine, std::mt19937& rng, float explore) const;
+template DominoMove DominoEvaluator::SelectMove<8>(const BasicDominoEngine<DoubleSix, DrawRules>& engine, std::mt19937& rng, float explore) const;
+template DominoMove DominoEvaluator::SelectMove<4>(const BasicDominoEngine<DoubleSix, AllFivesRules>& engine, std::mt19937& rng, float explore) const;
+template DominoMove DominoEvaluator::SelectMove<5>(const BasicDominoEngine<DoubleSix, AllFivesRules>& engine, std::mt19937& rng, float explore) const;
+template DominoMove DominoEvaluator::SelectMove<6>(const BasicDominoEngine<DoubleSix, AllFivesRules>& engine, std::mt19937& rng, float explore) const;
+template DominoMove DominoEvaluator::SelectMove<7>(const BasicDominoEngine<DoubleSix, AllFivesRules>& engine, std::mt19937& rng, float explore) const;
+template DominoMove DominoEvaluator::SelectMove<8>(const BasicDominoEngine<DoubleSix, AllFivesRules>& engine, std::mt19937& rng, float explore) const;
+
+EvalWeights& DominoEvaluator::GetWeights()
+{
+    return Weights;
+}
+
+const EvalWeights& DominoEvaluator::GetWeights() const
+{
+    return Weights;
+}
+
+void DominoEvaluator::SetWeights(const EvalWeights& weights)
+{
+    Weights = weights;
+}
+
+bool DominoEvaluator::LoadWeights(const char* path)
+{
+    std::ifstream file(path);
+    if (!file) {
+        return false;
+    }
+
+    EvalWeights weights;
+    int         count = 0;
+    std::string line;
+    while (count < EvalFeature_COUNT && std::getline(file, line)) {
+        if (line.empty() || line[0] == '#') {
+            continue;
+        }
+        try {
+            weights[count++] = std::stof(line);
+        }
+        catch (...) {
+            return false;
+        }
+    }
+
+    if (count != EvalFeature_COUNT) {
+        return false;
+    }
+
+    Weights = weights;
+    return true;
+}
+
+bool DominoEvaluator::SaveWeights(const char* path) const
+{
+    std::ofstream file(path, std::ios::trunc);
+    if (!file) {
+        return false;
+    }
+
+    file << "# DominoEvaluator weights\n";
+    for (int i = 0; i < EvalFeature_COUNT; i++) {
+        file << Weights[i] << " # " << FeatureNames[i] << '\n';
+    }
+
+    return static_cast<bool>(file);
+}
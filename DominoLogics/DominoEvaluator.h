@@ -0,0 +1,64 @@
+#pragma once
+
+#include "DominoEngine.h"
+
+// Position features seen from one player. Only uses what that player can know: its own hand, the board,
+// and the number of cards the other players are holding.
+enum EvalFeature_
+{
+	EvalFeature_Bias,
+	EvalFeature_RemainingCards,       // Own remaining cards over the dealt cards
+	EvalFeature_SumOfCards,           // Own sum of cards, the FindTheLowestSum tie breaker
+	EvalFeature_FewestOpponentCards,  // The closest opponent to emptying their hand
+	EvalFeature_CardLead,             // Average opponent cards minus own cards
+	EvalFeature_PlayableTiles,        // Own tiles that can be attacked on the open ends
+	EvalFeature_UnseenEndTiles,       // Tiles not in own hand nor the board that fit the open ends
+	EvalFeature_DistinctPips,         // Pip numbers in own hand
+	EvalFeature_Doubles,              // Doubles in own hand, the hardest tiles to get rid of
+	EvalFeature_PipControl,           // Pip numbers where own hand holds at least as much as the unseen tiles
+	EvalFeature_TurnDistance,         // Turns until the player attacks again
+	EvalFeature_Progress,             // Tiles already on the board
+	EvalFeature_COUNT
+};
+
+using EvalFeatures = std::array<float, EvalFeature_COUNT>;
+using EvalWeights  = std::array<float, EvalFeature_COUNT>;
+
+//-----------------------------------------------------------------------------------------------------------------------
+// DominoEvaluator CLASS
+//-----------------------------------------------------------------------------------------------------------------------
+
+class DominoEvaluator
+{
+private:
+	EvalWeights Weights;
+
+public:
+	DominoEvaluator();
+
+	static void ExtractFeatures(const DominoEngine& engine, uint16_t player, EvalFeatures& features);
+	static EvalWeights DefaultWeights();
+
+	// Probability that the player wins the game from this position
+	float      Evaluate(const DominoEngine& engine, uint16_t player) const;
+	// Evaluate specialized for N players, for searches that already dispatched on the number of players.
+	// Takes the engine of any double-six rule variant, the features don't depend on the rules
+	template<uint16_t N, typename Engine>
+	float      Evaluate(const Engine& engine, uint16_t player) const;
+	float      EvaluateFeatures(const EvalFeatures& features) const;
+	// Plays every legal move and keeps the one with the best evaluation. Random move with the explore probability
+	DominoMove SelectMove(const DominoEngine& engine, std::mt19937& rng, float explore = 0.0f) const;
+	// SelectMove specialized for N players, for simulations that already dispatched on the number of players
+	template<uint16_t N, typename Engine>
+	DominoMove SelectMove(const Engine& engine, std::mt19937& rng, float explore = 0.0f) const;
+
+	EvalWeights&       GetWeights();
+	const EvalWeights& GetWeights() const;
+	void               SetWeights(const EvalWeights& weights);
+	bool               LoadWeights(const char* path);
+	bool               SaveWeights(const char* path) const;
+
+private:
+	template<uint16_t N, typename Engine>
+	static void ExtractFeatures(const Engine& engine, uint16_t player, EvalFeatures& features);
+};
@@ -0,0 +1,861 @@
+#include "DominoSearch.h"
+#include <algorithm>
+#include <cmath>
+#include <thread>
+
+using namespace dengine;
+
+//-----------------------------------------------------------------------------------------------------------------------
+// TimeManager CLASS
+//-----------------------------------------------------------------------------------------------------------------------
+
+TimeManager::TimeManager(double budget) : Budget(budget)
+{
+}
+
+void TimeManager::SetBudget(double seconds)
+{
+    Budget = seconds;
+}
+
+double TimeManager::GetBudget() const
+{
+    return Budget;
+}
+
+void TimeManager::StartMove(float phase, uint16_t moves)
+{
+    // From 1.3 budgets on the first move down to 0.7 on the last tile, and from 0.75 with two moves to choose from up
+    // to 1.4 with six or more
+    const double phase_share = 1.3 - 0.6 * std::min(phase, 1.0f);
+    const double moves_share = std::clamp(0.4 + moves / 6.0, 0.75, 1.4);
+    Target  = Budget * phase_share * moves_share;
+    Start   = Clock::now();
+    Stopped = false;
+}
+
+bool TimeManager::Continue(float instability) const
+{
+    const double limit = std::min(Target * (1.0 + 1.5 * instability), Budget * MaxStretch);
+    return !Stopped.load(std::memory_order_relaxed) && Elapsed() < limit;
+}
+
+void TimeManager::Stop()
+{
+    Stopped = true;
+}
+
+double TimeManager::Elapsed() const
+{
+    return std::chrono::duration<double>(Clock::now() - Start).count();
+}
+
+//-----------------------------------------------------------------------------------------------------------------------
+// TranspositionTable CLASS
+//-----------------------------------------------------------------------------------------------------------------------
+
+TranspositionTable::TranspositionTable(size_t max_bytes)
+{
+    Resize(max_bytes);
+}
+
+void TranspositionTable::Resize(size_t max_bytes)
+{
+    const size_t buckets = std::bit_floor(std::max<size_t>(1, max_bytes / sizeof(Bucket)));
+    Buckets    = std::make_unique<Bucket[]>(buckets);
+    BucketMask = buckets - 1;
+}
+
+void TranspositionTable::Clear()
+{
+    for (uint64_t b = 0; b <= BucketMask; b++) {
+        for (Entry& entry : Buckets[b].Entries) {
+            entry.Check.store(0, std::memory_order_relaxed);
+            for (auto& data : entry.Data) {
+                data.store(0, std::memory_order_relaxed);
+            }
+        }
+    }
+}
+
+void TranspositionTable::NewSearch()
+{
+    Generation.fetch_add(1, std::memory_order_relaxed);
+}
+
+bool TranspositionTable::Probe(uint64_t key, int depth, uint16_t players, Values& values) const
+{
+    for (const Entry& entry : Buckets[key & BucketMask].Entries) {
+        const uint64_t check = entry.Check.load(std::memory_order_relaxed);
+        const uint64_t info  = entry.Data[0].load(std::memory_order_relaxed);
+        const uint64_t low   = entry.Data[1].load(std::memory_order_relaxed);
+        const uint64_t high  = entry.Data[2].load(std::memory_order_relaxed);
+        if ((check ^ info ^ low ^ high) != key) {
+            continue;
+        }
+        if (static_cast<int>(info & 0xFF) < depth) {
+            return false;
+        }
+        for (uint16_t p = 0; p < players; p++) {
+            const uint64_t word = p < 4 ? low : high;
+            values[p] = static_cast<float>((word >> (p % 4 * 16)) & 0xFFFF) / 65535.0f;
+        }
+        return true;
+    }
+    return false;
+}
+
+void TranspositionTable::Store(uint64_t key, int depth, uint16_t players, const Values& values)
+{
+    const uint8_t generation = Generation.load(std::memory_order_relaxed);
+    const uint64_t info      = static_cast<uint64_t>(std::clamp(depth, 0, 0xFF)) | uint64_t(generation) << 8;
+    uint64_t       words[2]  = {};
+    for (uint16_t p = 0; p < players; p++) {
+        const uint64_t fraction = static_cast<uint64_t>(std::clamp(values[p], 0.0f, 1.0f) * 65535.0f + 0.5f);
+        words[p / 4] |= fraction << (p % 4 * 16);
+    }
+
+    // The entry of the same position, or else the one of an older search, or else the shallower one
+    Bucket& bucket  = Buckets[key & BucketMask];
+    Entry*  replace = nullptr;
+    int     worst   = INT32_MAX;
+    for (Entry& entry : bucket.Entries) {
+        const uint64_t check     = entry.Check.load(std::memory_order_relaxed);
+        const uint64_t old_info  = entry.Data[0].load(std::memory_order_relaxed);
+        const uint64_t old_key   = check ^ old_info ^ entry.Data[1].load(std::memory_order_relaxed) ^ entry.Data[2].load(std::memory_order_relaxed);
+        if (old_key == key) {
+            if (static_cast<int>(old_info & 0xFF) > depth) {
+                return;
+            }
+            replace = &entry;
+            break;
+        }
+        const int priority = static_cast<int>(old_info & 0xFF) + (static_cast<uint8_t>(old_info >> 8) == generation ? 0x100 : 0);
+        if (priority < worst) {
+            worst   = priority;
+            replace = &entry;
+        }
+    }
+
+    replace->Check.store(key ^ info ^ words[0] ^ words[1], std::memory_order_relaxed);
+    replace->Data[0].store(info, std::memory_order_relaxed);
+    replace->Data[1].store(words[0], std::memory_order_relaxed);
+    replace->Data[2].store(words[1], std::memory_order_relaxed);
+}
+
+size_t TranspositionTable::GetSize() const
+{
+    return (BucketMask + 1) * sizeof(Bucket);
+}
+
+//-----------------------------------------------------------------------------------------------------------------------
+// MctsNodePool CLASS
+//-----------------------------------------------------------------------------------------------------------------------
+
+MctsNodePool::MctsNodePool(size_t max_bytes)
+{
+    SetMemoryLimit(max_bytes);
+}
+
+void MctsNodePool::SetMemoryLimit(size_t max_bytes)
+{
+    MaxBytes = max_bytes;
+    if (MemoryUsed() > MaxBytes) {
+        Nodes.clear();
+        Nodes.shrink_to_fit();
+        Edges.clear();
+        Edges.shrink_to_fit();
+        UsedNodes = 0;
+        UsedEdges = 0;
+    }
+}
+
+void MctsNodePool::Reset(uint32_t expected_nodes)
+{
+    UsedNodes = 0;
+    UsedEdges = 0;
+
+    // Most nodes are leaves, so the edges take about as many slots as there are nodes
+    const size_t expected = std::min<size_t>(expected_nodes, MaxSlots());
+    if (Nodes.size() < expected) {
+        Nodes.resize(expected);
+    }
+    if (Edges.size() < expected) {
+        Edges.resize(expected);
+    }
+}
+
+void MctsNodePool::Reroot(uint32_t node)
+{
+    std::vector<MctsNode> nodes;
+    std::vector<MctsEdge> edges;
+    nodes.reserve(Nodes.size());
+    edges.reserve(Edges.size());
+
+    // The edge blocks are copied full, the next child of a node moves its block to the end
+    nodes.push_back(Nodes[node]);
+    for (uint32_t n = 0; n < nodes.size(); n++) {
+        const uint32_t first = nodes[n].FirstEdge;
+        nodes[n].FirstEdge    = static_cast<uint32_t>(edges.size());
+        nodes[n].EdgeCapacity = nodes[n].NumChildren;
+        for (uint32_t e = first; e < first + nodes[n].NumChildren; e++) {
+            edges.push_back({ static_cast<uint32_t>(nodes.size()), Edges[e].Move, Edges[e].Player });
+            nodes.push_back(Nodes[Edges[e].Node]);
+        }
+    }
+
+    UsedNodes = static_cast<uint32_t>(nodes.size());
+    UsedEdges = static_cast<uint32_t>(edges.size());
+    nodes.resize(nodes.capacity());
+    edges.resize(edges.capacity());
+    Nodes.swap(nodes);
+    Edges.swap(edges);
+}
+
+size_t MctsNodePool::MaxSlots() const
+{
+    return MaxBytes / (sizeof(MctsNode) + sizeof(MctsEdge));
+}
+
+size_t MctsNodePool::EdgesAfterAdd(uint32_t parent) const
+{
+    size_t edges = UsedEdges;
+    if (parent != NoNode && Nodes[parent].NumChildren == Nodes[parent].EdgeCapacity) {
+        edges += std::max<size_t>(4, Nodes[parent].EdgeCapacity * size_t(2));
+    }
+    return edges;
+}
+
+bool MctsNodePool::CanAdd(uint32_t parent) const
+{
+    return UsedNodes < NoNode && UsedNodes < MaxSlots() && EdgesAfterAdd(parent) <= MaxSlots();
+}
+
+uint32_t MctsNodePool::Add(uint32_t parent, const DominoMove& move, uint16_t player)
+{
+    if (!CanAdd(parent)) {
+        return NoNode;
+    }
+
+    if (UsedNodes == Nodes.size()) {
+        Nodes.resize(std::min(MaxSlots(), std::max<size_t>(1024, Nodes.size() * 2)));
+    }
+    const uint32_t node = UsedNodes++;
+    Nodes[node]         = MctsNode();
+    Nodes[node].Move    = move;
+    Nodes[node].Player  = static_cast<uint8_t>(player);
+    if (parent == NoNode) {
+        return node;
+    }
+
+    // A full block of edges is moved to a new one twice as big at the end of the arena. The old block stays unused
+    // until the next reset
+    MctsNode& p = Nodes[parent];
+    if (p.NumChildren == p.EdgeCapacity) {
+        const uint16_t capacity = static_cast<uint16_t>(std::max(4, p.EdgeCapacity * 2));
+        if (UsedEdges + capacity > Edges.size()) {
+            Edges.resize(std::min(MaxSlots(), std::max<size_t>({ 1024, Edges.size() * 2, UsedEdges + size_t(capacity) })));
+        }
+        std::copy_n(Edges.begin() + p.FirstEdge, p.NumChildren, Edges.begin() + UsedEdges);
+        p.FirstEdge     = UsedEdges;
+        p.EdgeCapacity  = capacity;
+        UsedEdges      += capacity;
+    }
+    Edges[p.FirstEdge + p.NumChildren++] = { node, move, static_cast<uint8_t>(player) };
+    return node;
+}
+
+std::span<const MctsEdge> MctsNodePool::Children(uint32_t node) const
+{
+    return { Edges.data() + Nodes[node].FirstEdge, Nodes[node].NumChildren };
+}
+
+uint32_t MctsNodePool::Size() const
+{
+    return UsedNodes;
+}
+
+size_t MctsNodePool::MemoryUsed() const
+{
+    return Nodes.size() * sizeof(MctsNode) + Edges.size() * sizeof(MctsEdge);
+}
+
+//-----------------------------------------------------------------------------------------------------------------------
+// BasicDominoSearch CLASS
+//-----------------------------------------------------------------------------------------------------------------------
+
+template<typename Engine>
+BasicDominoSearch<Engine>::BasicDominoSearch(const DominoEvaluator& evaluator, const SearchLimits& limits) :
+    Evaluator(&evaluator),
+    Limits(limits),
+    Tree(limits.MaxTreeMemory)
+{}
+
+template<typename Engine>
+void BasicDominoSearch<Engine>::SetLimits(const SearchLimits& limits)
+{
+    Limits = limits;
+    Tree.SetMemoryLimit(limits.MaxTreeMemory);
+    // A lower limit can clear the pool, and the kept tree with it
+    if (Tree.Size() == 0) {
+        TreeValid = false;
+    }
+}
+
+template<typename Engine>
+const SearchLimits& BasicDominoSearch<Engine>::GetLimits() const
+{
+    return Limits;
+}
+
+template<typename Engine>
+void BasicDominoSearch<Engine>::SetTranspositionTable(TranspositionTable* table)
+{
+    Table = table;
+}
+
+template<typename Engine>
+void BasicDominoSearch<Engine>::SetTimeManager(const TimeManager* time)
+{
+    Time = time;
+}
+
+template<typename Engine>
+void BasicDominoSearch<Engine>::SetTablebase(const Tablebase* table)
+{
+    Endgame = table;
+}
+
+template<typename Engine>
+void BasicDominoSearch<Engine>::Determinize(const Engine& engine, uint16_t player, Engine& world, std::mt19937& rng)
+{
+    using Set = typename Engine::TileSet;
+
+    Mask all_tiles{};
+    for (const Mask& pip_tiles : Set::PipTiles) {
+        all_tiles |= pip_tiles;
+    }
+
+    world = engine;
+    Mask unseen = all_tiles & ~engine.GetHand(player) & ~engine.GetPlayedTiles();
+
+    // Everyone knows who has to open, and with what
+    const uint8_t  required       = engine.GetRequiredTile();
+    const uint16_t required_owner = engine.GetCurrentTurn();
+    const bool     required_known = required != NoTile && required_owner != player;
+    if (required_known) {
+        unseen &= ~TileBit<Mask>(required);
+    }
+
+    std::array<uint8_t, Set::NumberOfTiles> tiles;
+    uint16_t number_of_tiles = 0;
+    for (Mask m = unseen; m; m = WithoutLowestTile(m)) {
+        tiles[number_of_tiles++] = LowestTile(m);
+    }
+    std::shuffle(tiles.begin(), tiles.begin() + number_of_tiles, rng);
+
+    uint16_t next_tile = 0;
+    for (uint16_t p = 0; p < engine.GetNumberOfPlayers(); p++) {
+        if (p == player) {
+            continue;
+        }
+        Mask     hand{};
+        uint16_t cards = engine.RemainingCards(p);
+        if (required_known && p == required_owner) {
+            hand |= TileBit<Mask>(required);
+            cards--;
+        }
+        for (uint16_t c = 0; c < cards; c++) {
+            hand |= TileBit<Mask>(tiles[next_tile++]);
+        }
+        world.SetHand(p, hand);
+    }
+
+    Mask boneyard{};
+    for (uint16_t c = static_cast<uint16_t>(CountTiles(engine.GetBoneyard())); c > 0; c--) {
+        boneyard |= TileBit<Mask>(tiles[next_tile++]);
+    }
+    world.SetBoneyard(boneyard);
+}
+
+template<typename Engine>
+void BasicDominoSearch<Engine>::GenerateSearchMoves(const Engine& engine, DominoMoveList& moves)
+{
+    engine.GenerateMoves(moves);
+    if (engine.NoDominoesYet() || engine.GetLeftEnd() != engine.GetRightEnd()) {
+        return;
+    }
+
+    // Both open ends show the same pip, a tile on the right gives the same game as on the left
+    const DominoMoveList all = moves;
+    moves.Clear();
+    for (const auto& move : all) {
+        if (move.Side != EngineSide_Right) {
+            moves.Add(move);
+        }
+    }
+}
+
+template<typename Engine>
+uint8_t BasicDominoSearch<Engine>::RandomBoneyardTile(const Engine& engine, std::mt19937& rng)
+{
+    Mask m = engine.GetBoneyard();
+    for (uint32_t skip = rng() % CountTiles(m); skip > 0; skip--) {
+        m = WithoutLowestTile(m);
+    }
+    return LowestTile(m);
+}
+
+//-----------------------------------------------------------------------------------------------------------------------
+// Determinized expectimax
+//-----------------------------------------------------------------------------------------------------------------------
+
+template<typename Engine>
+SearchResult BasicDominoSearch<Engine>::ExpectiMax(const Engine& engine, std::mt19937& rng)
+{
+    return DispatchPlayers<typename Engine::TileSet>(engine.GetNumberOfPlayers(), [&](auto players) { return ExpectiMaxN<players()>(engine, rng); });
+}
+
+template<typename Engine>
+template<uint16_t N>
+SearchResult BasicDominoSearch<Engine>::ExpectiMaxN(const Engine& engine, std::mt19937& rng)
+{
+    SearchResult result;
+    if (engine.GetForcedMove(result.Move)) {
+        return result;
+    }
+
+    DominoMoveList moves;
+    GenerateSearchMoves(engine, moves);
+    const uint16_t player = engine.GetCurrentTurn();
+    if (Table != nullptr) {
+        Table->NewSearch();
+    }
+
+    // Every determinization has its own random stream and its own row of values, so the result doesn't depend on
+    // which thread searched it
+    std::vector<uint32_t> seeds(Limits.Determinizations);
+    for (uint32_t& seed : seeds) {
+        seed = rng();
+    }
+    std::vector<std::array<float, MaxMoves>> move_values(Limits.Determinizations);
+    std::atomic<uint32_t> next_determinization = 0;
+    std::atomic<uint32_t> searched             = 0;
+    std::atomic<uint64_t> nodes                = 0;
+
+    const auto search_determinizations = [&]() {
+        Engine       world;
+        UndoRecord   undo;
+        PlayerValues values;
+        uint64_t     thread_nodes = 0;
+        for (uint32_t d = next_determinization++; d < Limits.Determinizations; d = next_determinization++) {
+            // Out of time, the determinizations searched so far make the result. There is always one
+            if (Time != nullptr && d > 0 && !Time->Continue()) {
+                break;
+            }
+            std::mt19937 world_rng(seeds[d]);
+            Determinize(engine, player, world, world_rng);
+            for (uint16_t i = 0; i < moves.Size; i++) {
+                world.template MakeMoveN<N>(moves[i], undo);
+                MaxN<N>(world, Limits.Depth - 1, false, world_rng, values, thread_nodes);
+                world.UnmakeMove(undo);
+                move_values[d][i] = values[player];
+            }
+            searched++;
+        }
+        nodes += thread_nodes;
+    };
+
+    std::vector<std::thread> helpers;
+    for (uint32_t t = 1; t < std::min(Limits.Threads, Limits.Determinizations); t++) {
+        helpers.emplace_back(search_determinizations);
+    }
+    search_determinizations();
+    for (std::thread& helper : helpers) {
+        helper.join();
+    }
+
+    // The rows of the determinizations that weren't searched are zeros
+    std::array<float, MaxMoves> sums{};
+    for (const auto& row : move_values) {
+        for (uint16_t i = 0; i < moves.Size; i++) {
+            sums[i] += row[i];
+        }
+    }
+
+    const uint16_t best = static_cast<uint16_t>(std::max_element(sums.begin(), sums.begin() + moves.Size) - sums.begin());
+    result.Move  = moves[best];
+    result.Value = sums[best] / std::max(1u, searched.load());
+    result.Nodes = nodes;
+    return result;
+}
+
+template<typename Engine>
+template<uint16_t N>
+void BasicDominoSearch<Engine>::MaxN(Engine& engine, int depth, bool drawing, std::mt19937& rng, PlayerValues& values, uint64_t& nodes) const
+{
+    nodes++;
+    if (engine.IsGameOver()) {
+        values.fill(0.0f);
+        values[engine.GetWinner()] = 1.0f;
+        return;
+    }
+    if constexpr (std::is_same_v<Engine, DominoEngine>) {
+        uint16_t winner;
+        if (Endgame != nullptr && Endgame->Probe(engine, winner)) {
+            values.fill(0.0f);
+            values[winner] = 1.0f;
+            return;
+        }
+    }
+
+    // Forced plies don't branch and don't use up the depth
+    DominoMove forced;
+    UndoRecord undo;
+    if (engine.GetForcedMove(forced) && !forced.IsDraw()) {
+        engine.template MakeMoveN<N>(forced, undo);
+        MaxN<N>(engine, depth, false, rng, values, nodes);
+        engine.UnmakeMove(undo);
+        return;
+    }
+
+    if (depth <= 0) {
+        float total = 0.0f;
+        for (uint16_t p = 0; p < N; p++) {
+            values[p] = Evaluator->template Evaluate<N>(engine, p);
+            total    += values[p];
+        }
+        for (uint16_t p = 0; p < N; p++) {
+            values[p] /= total;
+        }
+        return;
+    }
+
+    // A probe can miss the cache, so only the nodes with a subtree worth it use the table
+    uint64_t key = 0;
+    if constexpr (std::is_same_v<PlayerValues, TranspositionTable::Values>) {
+        if (Table != nullptr && depth >= 2) {
+            key = engine.GetHash() ^ (drawing ? DrawingKey : 0);
+            if (Table->Probe(key, depth, N, values)) {
+                return;
+            }
+        }
+    }
+
+    DominoMoveList moves;
+    GenerateSearchMoves(engine, moves);
+    PlayerValues child;
+
+    if (moves[0].IsDraw()) {
+        // Chance node, sampled without replacement and weighted equally
+        std::array<uint8_t, Engine::TileSet::NumberOfTiles> tiles;
+        uint16_t number_of_tiles = 0;
+        for (Mask m = engine.GetBoneyard(); m; m = WithoutLowestTile(m)) {
+            tiles[number_of_tiles++] = LowestTile(m);
+        }
+
+        const uint16_t width = drawing ? 1 : std::min(Limits.ChanceWidth, number_of_tiles);
+        values.fill(0.0f);
+        for (uint16_t i = 0; i < width; i++) {
+            std::swap(tiles[i], tiles[i + rng() % (number_of_tiles - i)]);
+            engine.template MakeMoveN<N>(DominoMove(tiles[i], EngineSide_Draw), undo);
+            MaxN<N>(engine, depth, true, rng, child, nodes);
+            engine.UnmakeMove(undo);
+            for (uint16_t p = 0; p < N; p++) {
+                values[p] += child[p] / width;
+            }
+        }
+    }
+    else {
+        const uint16_t mover = engine.GetCurrentTurn();
+        float          best  = -1.0f;
+        for (const auto& move : moves) {
+            engine.template MakeMoveN<N>(move, undo);
+            MaxN<N>(engine, depth - 1, false, rng, child, nodes);
+            engine.UnmakeMove(undo);
+            if (child[mover] > best) {
+                best   = child[mover];
+                values = child;
+            }
+        }
+    }
+
+    if constexpr (std::is_same_v<PlayerValues, TranspositionTable::Values>) {
+        if (Table != nullptr && depth >= 2) {
+            Table->Store(key, depth, N, values);
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------------------------------------------------
+// Information set MCTS
+//-----------------------------------------------------------------------------------------------------------------------
+
+template<typename Engine>
+SearchResult BasicDominoSearch<Engine>::Mcts(const Engine& engine, std::mt19937& rng)
+{
+    SearchResult result;
+    if (engine.GetForcedMove(result.Move)) {
+        // The tree stays for the next search if it's at this position
+        TreeValid = TreeValid && TreeRoot.GetHash() == engine.GetHash();
+        return result;
+    }
+
+    const uint16_t player = engine.GetCurrentTurn();
+    RootTree(engine, player);
+    DispatchPlayers<typename Engine::TileSet>(engine.GetNumberOfPlayers(), [&](auto players) { MctsN<players()>(engine, player, Limits.Iterations, Time, rng); });
+
+    // The most visited move is the most robust choice
+    const uint32_t best = MostVisitedChild(0, player);
+    if (best != NoNode) {
+        result.Move  = Tree[best].Move;
+        result.Value = Tree[best].Wins / Tree[best].Visits;
+    }
+    result.Nodes = Tree.Size();
+    return result;
+}
+
+template<typename Engine>
+void BasicDominoSearch<Engine>::Ponder(const Engine& engine, uint16_t player, uint32_t iterations, std::mt19937& rng)
+{
+    if (engine.IsGameOver()) {
+        return;
+    }
+
+    RootTree(engine, player);
+    DispatchPlayers<typename Engine::TileSet>(engine.GetNumberOfPlayers(), [&](auto players) { MctsN<players()>(engine, player, iterations, nullptr, rng); });
+}
+
+template<typename Engine>
+void BasicDominoSearch<Engine>::RootTree(const Engine& engine, uint16_t player)
+{
+    if (TreeValid && TreePlayer == player && TreeRoot.GetHash() == engine.GetHash()) {
+        if (TreeNode != 0) {
+            Tree.Reroot(TreeNode);
+        }
+    }
+    else {
+        // At most a node per iteration, so the nodes are only allocated here
+        Tree.Reset(Limits.Iterations + 1);
+        Tree.Add(NoNode, DominoMove(), player);
+    }
+    TreeRoot   = engine;
+    TreeNode   = 0;
+    TreePlayer = player;
+    TreeValid  = true;
+}
+
+template<typename Engine>
+void BasicDominoSearch<Engine>::AdvanceTree(const DominoMove& move)
+{
+    if (!TreeValid) {
+        return;
+    }
+
+    // The edge the search would have made for the move: the draws of the other players are hidden and both open ends
+    // showing the same pip make a tile on the right the same move as on the left
+    const uint16_t mover = TreeRoot.GetCurrentTurn();
+    DominoMove     edge  = move;
+    if (move.IsDraw() && mover != TreePlayer) {
+        edge = DominoMove(NoTile, EngineSide_Draw);
+    }
+    else if (move.Side == EngineSide_Right && (TreeRoot.NoDominoesYet() || TreeRoot.GetLeftEnd() == TreeRoot.GetRightEnd())) {
+        edge.Side = EngineSide_Left;
+    }
+
+    // Forced plies are played without nodes in the determinizations where they are forced, so a pass never has one.
+    // Another player's only move can still have a node from the deals where it wasn't forced, the node is followed then
+    // and the ply is skipped when there is none
+    DominoMove     forced;
+    const bool     is_forced = TreeRoot.GetForcedMove(forced) && !forced.IsDraw();
+    const uint32_t child     = move.IsPass() ? NoNode : FindChild(TreeNode, edge, mover);
+    if (child != NoNode) {
+        TreeNode = child;
+    }
+    else if (!is_forced) {
+        TreeValid = false;
+        return;
+    }
+    TreeRoot.PlayMove(move);
+}
+
+template<typename Engine>
+void BasicDominoSearch<Engine>::ForgetTree()
+{
+    TreeValid = false;
+}
+
+template<typename Engine>
+uint16_t BasicDominoSearch<Engine>::GetRootMoves(std::array<RootMove, MaxMoves>& moves) const
+{
+    if (!TreeValid || TreeRoot.GetCurrentTurn() != TreePlayer) {
+        return 0;
+    }
+
+    uint16_t count = 0;
+    for (const MctsEdge& edge : Tree.Children(TreeNode)) {
+        const MctsNode& node = Tree[edge.Node];
+        if (edge.Player != TreePlayer || node.Visits == 0 || count == MaxMoves) {
+            continue;
+        }
+        moves[count++] = RootMove{ edge.Move, node.Wins / node.Visits, node.Visits };
+    }
+    std::sort(moves.begin(), moves.begin() + count, [](const RootMove& a, const RootMove& b) { return a.Visits > b.Visits; });
+    return count;
+}
+
+template<typename Engine>
+uint32_t BasicDominoSearch<Engine>::MostVisitedChild(uint32_t node, uint16_t player) const
+{
+    // A kept tree can have another player's moves at its root, from the deals where the player after them had to pass
+    uint32_t best = NoNode;
+    for (const MctsEdge& edge : Tree.Children(node)) {
+        if (edge.Player != player) {
+            continue;
+        }
+        if (best == NoNode || Tree[edge.Node].Visits > Tree[best].Visits) {
+            best = edge.Node;
+        }
+    }
+    return best;
+}
+
+template<typename Engine>
+uint32_t BasicDominoSearch<Engine>::FindChild(uint32_t node, const DominoMove& move, uint16_t player) const
+{
+    // With the forced plies skipped, the same node can be reached with different players to move
+    for (const MctsEdge& edge : Tree.Children(node)) {
+        if (edge.Move == move && edge.Player == player) {
+            return edge.Node;
+        }
+    }
+    return NoNode;
+}
+
+template<typename Engine>
+template<uint16_t N>
+void BasicDominoSearch<Engine>::MctsN(const Engine& engine, uint16_t player, uint32_t iterations, const TimeManager* time, std::mt19937& rng)
+{
+    DominoMoveList        moves;
+    Engine                world;
+    std::vector<uint32_t> path;
+    std::array<DominoMove, MaxMoves> untried;
+    uint32_t              best_move   = NoNode;
+    float                 instability = 0.0f;
+    for (uint32_t iteration = 0; iteration < iterations; iteration++) {
+        // The clock is checked every TimeCheckInterval iterations, along with how often the most visited root move
+        // changed, which buys more time
+        if (time != nullptr && iteration % TimeCheckInterval == 0 && iteration > 0) {
+            const uint32_t best = MostVisitedChild(0, player);
+            instability = 0.9f * instability + (best != best_move ? 0.1f : 0.0f);
+            best_move   = best;
+            if (!time->Continue(instability)) {
+                break;
+            }
+        }
+
+        Determinize(engine, player, world, rng);
+        path.assign(1, 0);
+        uint32_t node = 0;
+
+        // Selection and expansion, one new node per iteration. Forced plies are played without nodes
+        while (!world.IsGameOver()) {
+            if (world.template PlayForcedMovesN<N>() > 0) {
+                continue;
+            }
+
+            GenerateSearchMoves(world, moves);
+            const uint16_t mover     = world.GetCurrentTurn();
+            uint32_t       next_node = NoNode;
+            bool           expanded  = false;
+            DominoMove     move;
+
+            if (moves[0].IsDraw()) {
+                move = DominoMove(RandomBoneyardTile(world, rng), EngineSide_Draw);
+                const DominoMove edge = mover == player ? move : DominoMove(NoTile, EngineSide_Draw);
+                next_node = FindChild(node, edge, mover);
+                if (next_node == NoNode) {
+                    next_node = Tree.Add(node, edge, mover);
+                    expanded  = true;
+                    if (next_node != NoNode) {
+                        Tree[next_node].Availability = 1;
+                    }
+                }
+            }
+            else {
+                uint16_t number_untried = 0;
+                float    best_ucb       = -1.0f;
+                for (const auto& legal : moves) {
+                    const uint32_t child = FindChild(node, legal, mover);
+                    if (child == NoNode) {
+                        untried[number_untried++] = legal;
+                        continue;
+                    }
+                    MctsNode& c = Tree[child];
+                    c.Availability++;
+                    const float ucb = c.Wins / c.Visits + Limits.Exploration * std::sqrt(std::log(static_cast<float>(c.Availability)) / c.Visits);
+                    if (ucb > best_ucb) {
+                        best_ucb  = ucb;
+                        next_node = child;
+                    }
+                }
+
+                if (number_untried > 0 && Tree.CanAdd(node)) {
+                    move      = untried[rng() % number_untried];
+                    next_node = Tree.Add(node, move, mover);
+                    expanded  = true;
+                    Tree[next_node].Availability = 1;
+                }
+                else if (next_node != NoNode) {
+                    move = Tree[next_node].Move;
+                }
+                else {
+                    // The tree is full and none of the legal moves has a node, the playout takes it from here
+                    move = untried[rng() % number_untried];
+                }
+            }
+
+            world.template PlayMoveN<N>(move);
+            if (next_node == NoNode) {
+                break;
+            }
+            path.push_back(next_node);
+            node = next_node;
+            if (expanded) {
+                break;
+            }
+        }
+
+        const uint16_t winner = world.IsGameOver() ? world.GetWinner() : Playout<N>(world, rng);
+        for (uint32_t n : path) {
+            Tree[n].Visits++;
+            Tree[n].Wins += Tree[n].Player == winner;
+        }
+    }
+}
+
+template<typename Engine>
+template<uint16_t N>
+uint16_t BasicDominoSearch<Engine>::Playout(Engine& world, std::mt19937& rng) const
+{
+    DominoMoveList moves;
+    while (!world.IsGameOver()) {
+        if constexpr (std::is_same_v<Engine, DominoEngine>) {
+            uint16_t winner;
+            if (Endgame != nullptr && Endgame->Probe(world, winner)) {
+                return winner;
+            }
+        }
+        world.GenerateMoves(moves);
+        DominoMove move = moves[rng() % moves.Size];
+        if (move.IsDraw()) {
+            move.Tile = RandomBoneyardTile(world, rng);
+        }
+        world.template PlayMoveN<N>(move);
+    }
+    return world.GetWinner();
+}
+
+template class BasicDominoSearch<DominoEngine>;
+template class BasicDominoSearch<BasicDominoEngine<DoubleSix, DrawRules>>;
+template class BasicDominoSearch<BasicDominoEngine<DoubleSix, AllFivesRules>>;
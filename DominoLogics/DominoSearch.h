@@ -0,0 +1,306 @@
+#pragma once
+
+#include "DominoEngine.h"
+#include "DominoEvaluator.h"
+#include "Tablebase.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <span>
+#include <vector>
+
+//-----------------------------------------------------------------------------------------------------------------------
+// Search under hidden hands and chance.
+// The searching player only knows their own hand, the board and how many tiles every other hand and the boneyard
+// hold, so both searches work on determinizations: deals of the unseen tiles that agree with that. Draws from the
+// boneyard are chance nodes.
+// ExpectiMax searches every determinization to a fixed depth with max-n backups, every player taking the move that
+// is best for themselves, and averages the root moves over the determinizations. A chance node expands at most
+// ChanceWidth sampled boneyard tiles with equal weights, and the draws after the first one of a turn are sampled
+// once, so a long run of draws doesn't multiply the tree. It walks every determinization in place with MakeMove and
+// UnmakeMove, so its memory is an undo record per ply of the search.
+// Mcts is single observer information set MCTS: one tree over what the searching player knows, a new determinization
+// every iteration and UCB over the moves that are legal in it. Chance edges are only made for the tiles that were
+// actually drawn, and the draws of the other players, which the searching player doesn't see, share a single edge.
+// ExpectiMax shares the determinizations out between Threads threads. With a TranspositionTable the positions that
+// are reached again through another move order, in any thread, are looked up instead of searched again.
+// The tree lives in an MctsNodePool. It stops growing when the pool reaches MaxTreeMemory, and the iterations after
+// that keep refining the nodes it has. The tree is kept after the search: when the game goes on from its root and the
+// moves are given to AdvanceTree, the next Mcts starts from the subtree of the position reached. Ponder grows the tree
+// of a player while another one is to move, so the search of that player's next turn starts from the pondered subtree.
+// A pass, and any other forced ply played without a node, keeps the node the tree is at.
+// Both searches are anytime with a TimeManager: the limits become maximums, and a search that runs out of time or is
+// stopped returns its best move so far, ExpectiMax over the determinizations it finished.
+// With a Tablebase the block game's endgame positions of every determinization are looked up instead of searched or
+// played out: ExpectiMax gets their perfect play value at any depth and the Mcts playouts stop at the first of them.
+//-----------------------------------------------------------------------------------------------------------------------
+
+struct SearchLimits
+{
+	uint32_t Determinizations = 24;        // ExpectiMax: sampled deals of the unseen tiles
+	int      Depth            = 4;         // ExpectiMax: plies before the evaluator, draws don't count
+	uint16_t ChanceWidth      = 3;         // ExpectiMax: boneyard tiles expanded by a chance node
+	uint32_t Threads          = 1;         // ExpectiMax: threads searching the determinizations
+	uint32_t Iterations       = 4000;      // Mcts
+	size_t   MaxTreeMemory    = 8 << 20;   // Mcts: bytes of the node pool, about 250k nodes
+	float    Exploration      = 0.7f;      // Mcts: UCB exploration constant
+};
+
+struct SearchResult
+{
+	DominoMove Move;
+	float      Value = 0.0f;   // Estimated win probability of the searching player after the move
+	uint64_t   Nodes = 0;      // Positions searched by ExpectiMax, nodes of the Mcts tree with the reused ones
+};
+
+// A move at the root of the Mcts tree
+struct RootMove
+{
+	DominoMove Move;
+	float      Value  = 0.0f;   // Win rate of the searching player after the move
+	uint32_t   Visits = 0;
+};
+
+//-----------------------------------------------------------------------------------------------------------------------
+// TimeManager CLASS
+//-----------------------------------------------------------------------------------------------------------------------
+
+// Splits a think-time budget between the moves of a game. A move gets more than the budget early on and with many legal
+// moves and less near the end, and the search stretches it while its best move keeps changing, up to MaxStretch times
+// the budget. Stop ends the search of the current move from any thread
+class TimeManager
+{
+private:
+	using Clock = std::chrono::steady_clock;
+
+	double            Budget;
+	double            Target  = 0.0;   // Seconds for the current move
+	Clock::time_point Start;
+	std::atomic<bool> Stopped = false;
+
+public:
+	static constexpr double MaxStretch = 2.5;
+
+	TimeManager(double budget = 1.0);
+
+	void   SetBudget(double seconds);
+	double GetBudget() const;
+	// Starts the clock of the current player's move
+	template<typename Engine>
+	void   StartMove(const Engine& engine);
+	// Starts the clock of a move, phase being the share of the player's hand already played
+	void   StartMove(float phase, uint16_t moves);
+	// Whether the search should go on. instability is how often its best move changed lately, from 0 to 1
+	bool   Continue(float instability = 0.0f) const;
+	void   Stop();
+	double Elapsed() const;
+};
+
+template<typename Engine>
+void TimeManager::StartMove(const Engine& engine)
+{
+	DominoMoveList moves;
+	engine.GenerateMoves(moves);
+	const float played = 1.0f - float(engine.RemainingCards(engine.GetCurrentTurn())) / engine.GetNumberOfCards();
+	StartMove(std::max(played, 0.0f), moves.Size);
+}
+
+//-----------------------------------------------------------------------------------------------------------------------
+// TranspositionTable CLASS
+//-----------------------------------------------------------------------------------------------------------------------
+
+// The values of the positions ExpectiMax has searched, keyed by BasicDominoEngine::GetHash. Its size is fixed when it's
+// made, and it's shared without locks by every thread of a search and by the searches that come after it.
+// A bucket is a cache line of two entries. An entry is four 64-bit words written and read one by one, the first being
+// the key XORed with the other three, so an entry that two threads wrote at the same time doesn't verify and is just
+// a miss. The values of the players are stored as 16-bit fractions
+class TranspositionTable
+{
+public:
+	using Values = std::array<float, dengine::MaxPlayers>;
+
+private:
+	struct Entry
+	{
+		std::atomic<uint64_t> Check{ 0 };     // The key XORed with the data
+		std::atomic<uint64_t> Data[3] = {};   // Depth and generation, then the values 4 to a word
+	};
+
+	struct alignas(64) Bucket
+	{
+		Entry Entries[2];
+	};
+
+	std::unique_ptr<Bucket[]> Buckets;
+	uint64_t                  BucketMask = 0;
+	std::atomic<uint8_t>      Generation = 0;
+
+public:
+	// The table takes the biggest power of two buckets that fits in max_bytes
+	TranspositionTable(size_t max_bytes = 32 << 20);
+
+	void   Resize(size_t max_bytes);
+	void   Clear();
+	// Makes the entries of the previous searches the first ones to be replaced
+	void   NewSearch();
+	// The values of the first players of a position searched at least depth plies deep
+	bool   Probe(uint64_t key, int depth, uint16_t players, Values& values) const;
+	void   Store(uint64_t key, int depth, uint16_t players, const Values& values);
+	size_t GetSize() const;
+};
+
+//-----------------------------------------------------------------------------------------------------------------------
+// MctsNodePool CLASS
+//-----------------------------------------------------------------------------------------------------------------------
+
+struct MctsNode
+{
+	uint32_t   FirstEdge    = 0;      // The children are NumChildren edges from FirstEdge on
+	uint16_t   NumChildren  = 0;
+	uint16_t   EdgeCapacity = 0;
+	uint32_t   Visits       = 0;
+	uint32_t   Availability = 0;      // Iterations where the move was legal at the parent
+	float      Wins         = 0.0f;
+	DominoMove Move;                  // The move from the parent
+	uint8_t    Player       = 0;      // The player that made the move
+};
+
+// A child of a node with the move that leads to it, so looking a move up never touches the child nodes
+struct MctsEdge
+{
+	uint32_t   Node;
+	DominoMove Move;
+	uint8_t    Player;
+};
+
+// The nodes of a tree and the edges to their children in two contiguous arenas, indexed with 32-bit integers. The
+// edges of a node are a block that doubles when it fills up, so the children are scanned sequentially, a node is 24
+// bytes and an edge 8. The arenas grow until they take MaxTreeMemory bytes between them and keep their memory when
+// they're reset, so the reset between moves is O(1) and a pool that is kept around stops allocating after its first
+// searches.
+class MctsNodePool
+{
+public:
+	static constexpr uint32_t NoNode = UINT32_MAX;
+
+private:
+	std::vector<MctsNode> Nodes;
+	std::vector<MctsEdge> Edges;
+	uint32_t              UsedNodes = 0;
+	uint32_t              UsedEdges = 0;
+	size_t                MaxBytes  = 0;
+
+public:
+	MctsNodePool(size_t max_bytes = SearchLimits().MaxTreeMemory);
+
+	void     SetMemoryLimit(size_t max_bytes);
+	// Forget every node. The memory is kept, and made ready for at least expected_nodes nodes
+	void     Reset(uint32_t expected_nodes = 0);
+	// Keep only the subtree of node, with node as the new root 0. The subtree is copied breadth first into new arenas
+	void     Reroot(uint32_t node);
+	// Whether a child can still be added to parent without going over the memory limit
+	bool     CanAdd(uint32_t parent) const;
+	// A new node with no children, the last child of parent. NoNode is the parent of the root. Returns NoNode when the
+	// pool is full
+	uint32_t Add(uint32_t parent, const DominoMove& move, uint16_t player);
+
+	std::span<const MctsEdge> Children(uint32_t node) const;
+
+	uint32_t Size() const;
+	size_t   MemoryUsed() const;
+
+	MctsNode&       operator [] (uint32_t node) { return Nodes[node]; }
+	const MctsNode& operator [] (uint32_t node) const { return Nodes[node]; }
+
+private:
+	// Slots of each arena, so the two of them never take more than MaxBytes
+	size_t   MaxSlots() const;
+	size_t   EdgesAfterAdd(uint32_t parent) const;
+};
+
+//-----------------------------------------------------------------------------------------------------------------------
+// BasicDominoSearch CLASS
+//-----------------------------------------------------------------------------------------------------------------------
+
+template<typename Engine>
+class BasicDominoSearch
+{
+public:
+	using Mask       = typename Engine::Mask;
+	using UndoRecord = typename Engine::UndoRecord;
+
+private:
+	static constexpr uint32_t NoNode            = MctsNodePool::NoNode;
+	static constexpr uint32_t TimeCheckInterval = 128;
+	// A chance node after a draw expands a single tile, so it's stored apart from the same position reached otherwise
+	static constexpr uint64_t DrawingKey        = 0x9E3779B97F4A7C15ull;
+
+	using PlayerValues = std::array<float, Engine::TileSet::MaxPlayers>;
+
+	const DominoEvaluator* Evaluator;
+	SearchLimits           Limits;
+	TranspositionTable*    Table   = nullptr;
+	const TimeManager*     Time    = nullptr;
+	const Tablebase*       Endgame = nullptr;
+	MctsNodePool           Tree;
+	Engine                 TreeRoot;               // The position of the last Mcts, moved on by AdvanceTree
+	uint32_t               TreeNode   = 0;         // The node of TreeRoot in the tree
+	uint16_t               TreePlayer = 0;         // The player the tree was searched for
+	bool                   TreeValid  = false;
+
+public:
+	BasicDominoSearch(const DominoEvaluator& evaluator, const SearchLimits& limits = SearchLimits());
+
+	void                SetLimits(const SearchLimits& limits);
+	const SearchLimits& GetLimits() const;
+	// The table ExpectiMax looks the positions up in, none by default. It can be shared with other searches
+	void                SetTranspositionTable(TranspositionTable* table);
+	// The clock ExpectiMax and Mcts stop on, none by default. Its move must be started before the search
+	void                SetTimeManager(const TimeManager* time);
+	// The endgame table both searches look the positions up in, none by default. It's only used for the block game with
+	// the table's number of players, and can be shared with other searches
+	void                SetTablebase(const Tablebase* table);
+
+	// Best move of the current player. Forced moves and draws are returned without searching, with a Value of 0
+	SearchResult ExpectiMax(const Engine& engine, std::mt19937& rng);
+	SearchResult Mcts(const Engine& engine, std::mt19937& rng);
+	// Runs iterations more Mcts iterations for player at a position where another player may be the one to move. It can
+	// be called over and over on the same position, every call going on with the same tree
+	void         Ponder(const Engine& engine, uint16_t player, uint32_t iterations, std::mt19937& rng);
+	// Follows a move played from the position the tree is at, so the next Mcts can start from its subtree. The tree
+	// is dropped when the move leaves it
+	void         AdvanceTree(const DominoMove& move);
+	void         ForgetTree();
+	// The searching player's moves at the position the tree is at, most visited first. Returns how many there are
+	uint16_t     GetRootMoves(std::array<RootMove, dengine::MaxMoves>& moves) const;
+
+	// Deals the tiles the player can't see to the other hands and the boneyard. Every hand keeps its size and the
+	// required opening tile stays with the player that has to open with it
+	static void Determinize(const Engine& engine, uint16_t player, Engine& world, std::mt19937& rng);
+
+private:
+	template<uint16_t N>
+	SearchResult ExpectiMaxN(const Engine& engine, std::mt19937& rng);
+	template<uint16_t N>
+	void         MaxN(Engine& engine, int depth, bool drawing, std::mt19937& rng, PlayerValues& values, uint64_t& nodes) const;
+	template<uint16_t N>
+	void         MctsN(const Engine& engine, uint16_t player, uint32_t iterations, const TimeManager* time, std::mt19937& rng);
+	template<uint16_t N>
+	uint16_t     Playout(Engine& world, std::mt19937& rng) const;
+
+	// Makes the tree ready to search engine for player, keeping the subtree of the position if the tree has it
+	void         RootTree(const Engine& engine, uint16_t player);
+	uint32_t     FindChild(uint32_t node, const DominoMove& move, uint16_t player) const;
+	uint32_t     MostVisitedChild(uint32_t node, uint16_t player) const;
+
+	// The legal moves without the right side duplicates when both open ends show the same pip
+	static void    GenerateSearchMoves(const Engine& engine, DominoMoveList& moves);
+	static uint8_t RandomBoneyardTile(const Engine& engine, std::mt19937& rng);
+};
+
+using DominoSearch = BasicDominoSearch<DominoEngine>;
+
+extern template class BasicDominoSearch<DominoEngine>;
+extern template class BasicDominoSearch<BasicDominoEngine<dengine::DoubleSix, dengine::DrawRules>>;
+extern template class BasicDominoSearch<BasicDominoEngine<dengine::DoubleSix, dengine::AllFivesRules>>;
@@ -1,1579 +1,2241 @@
-#include "GameLogic.h"
-#include "imgui_internal.h"
-
-//-----------------------------------------------------------------------------------------------------------------------
-// DominoTile CLASS
-//-----------------------------------------------------------------------------------------------------------------------
-
-constexpr DominoTile::DominoTile(uint16_t num1, uint16_t num2) :
-	removed(false),
-	left_number(num1),
-	right_number(num2)
-{}
-
-constexpr uint16_t DominoTile::TileSum()
-{
-	return left_number + right_number;
-}
-
-constexpr bool DominoTile::IsDoubleNumber() const
-{
-	return left_number == right_number;
-}
-
-constexpr bool DominoTile::IsRemoved() const
-{
-	return removed;
-}
-
-constexpr uint16_t DominoTile::GetLeftNumber() const
-{
-	return left_number;
-}
-
-constexpr uint16_t DominoTile::GetRightNumber() const
-{
-	return right_number;
-}
-
-void DominoTile::ChangeCardRemoveState(bool r)
-{
-    this->removed = r;
-}
-
-
-
-//-----------------------------------------------------------------------------------------------------------------------
-// Player CLASS
-//-----------------------------------------------------------------------------------------------------------------------
-
-Player::Player(const uint16_t& p_num)
-{
-    PlayerNumber = p_num;
-}
-
-uint16_t Player::GetPlayerNum() const
-{
-    return PlayerNumber;
-}
-
-std::vector<Domino2D*>& Player::GetPlayerCards()
-{
-    return PlayerCards;
-}
-
-bool Player::HasTheDouble(uint16_t num) const
-{
-    for (auto& DT : PlayerCards) {
-        if (DT->IsDoubleNumber()) {
-            if (DT->GetLeftNumber() == num) {
-                return true;
-            }
-        }
-    }
-    return false;
-}
-
-bool Player::HasTheHighestCard(uint16_t num1, uint16_t num2) const
-{
-    for (auto& DT : PlayerCards) {
-        if (!DT->IsDoubleNumber()) {
-            if (DT->GetLeftNumber() == num1 && DT->GetRightNumber() == num2) {
-                return true;
-            }
-        }
-    }
-    return false;
-}
-
-uint16_t Player::SumOfCards() const
-{
-    uint16_t sum = 0;
-
-    for (auto Card : PlayerCards) {
-        if (Card->IsRemoved()) {
-            sum += (Card->GetLeftNumber() + Card->GetRightNumber());
-        }
-    }
-
-    return sum;
-}
-
-uint16_t Player::NumberOfCards() const
-{
-    uint16_t numcard = 0;
-
-    for (auto* Card : PlayerCards) {
-        if (!Card->IsRemoved()) {
-            numcard++;
-        }
-    }
-
-    return numcard;
-}
-
-void Player::SetClickedCard(Domino2D* dcard)
-{
-    CurrentlyClickedCard = dcard;
-}
-
-Domino2D* Player::GetClickedCard()
-{
-    return CurrentlyClickedCard;
-}
-
-void Player::ClearCards()
-{
-    PlayerCards.clear();
-}
-
-void Player::SetPlayerNum(uint16_t p_num)
-{
-    PlayerNumber = p_num;
-}
-
-void Player::SetCard(Domino2D& card)
-{
-    PlayerCards.push_back(&card);
-}
-
-uint16_t Player::GetRemainingCards()
-{
-    uint16_t remaining_cards = 0;
-
-    for (auto& C : PlayerCards) {
-        if (!C->IsRemoved()) {
-            remaining_cards++;
-        }
-    }
-
-    return remaining_cards;
-}
-
-
-
-//-----------------------------------------------------------------------------------------------------------------------
-// Domino2D CLASS
-//-----------------------------------------------------------------------------------------------------------------------
-
-// Functions for drawing the dots of the dominoes
-namespace domino_dots
-{
-    // Draw the left side of the domino. Vertically, it's the upper side.
-    static void leftDotNumber(uint16_t number, const ImVec2& pos, float scale, ImU32 color, bool vertical = false)
-    {
-        ImDrawList* draw_list = ImGui::GetWindowDrawList();
-        switch (number)
-        {
-        case 1:
-            draw_list->AddCircleFilled(ImVec2(pos.x + (scale * 10.5f), pos.y + (scale * 10.5f)), scale * 2.5f, color, 40);
-            break;
-        case 2:
-            if (vertical) {
-                draw_list->AddCircleFilled(ImVec2(pos.x + (scale * 4.0f), pos.y + (scale * 4.0f)), scale * 2.5f, color, 40);
-                draw_list->AddCircleFilled(ImVec2(pos.x + (scale * 17.0f), pos.y + (scale * 17.0f)), scale * 2.5f, color, 40);
-            }
-            else {
-                draw_list->AddCircleFilled(ImVec2(pos.x + (scale * 17.0f), pos.y + (scale * 4.0f)), scale * 2.5f, color, 40);
-                draw_list->AddCircleFilled(ImVec2(pos.x + (scale * 4.0f), pos.y + (scale * 17.0f)), scale * 2.5f, color, 40);
-            }
-            break;
-        case 3:
-            if (vertical) {
-                draw_list->AddCircleFilled(ImVec2(pos.x + (scale * 4.0f), pos.y + (scale * 4.0f)), scale * 2.5f, color, 40);
-                draw_list->AddCircleFilled(ImVec2(pos.x + (scale * 10.5f), pos.y + (scale * 10.5f)), scale * 2.5f, color, 40);
-                draw_list->AddCircleFilled(ImVec2(pos.x + (scale * 17.0f), pos.y + (scale * 17.0f)), scale * 2.5f, color, 40);
-            }
-            else {
-                draw_list->AddCircleFilled(ImVec2(pos.x + (scale * 17.0f), pos.y + (scale * 4.0f)), scale * 2.5f, color, 40);
-                draw_list->AddCircleFilled(ImVec2(pos.x + (scale * 10.5f), pos.y + (scale * 10.5f)), scale * 2.5f, color, 40);
-                draw_list->AddCircleFilled(ImVec2(pos.x + (scale * 4.0f), pos.y + (scale * 17.0f)), scale * 2.5f, color, 40);
-            }
-            break;
-        case 4:
-            draw_list->AddCircleFilled(ImVec2(pos.x + (scale * 4.0f), pos.y + (scale * 4.0f)), scale * 2.5f, color, 40);
-            draw_list->AddCircleFilled(ImVec2(pos.x + (scale * 17.0f), pos.y + (scale * 17.0f)), scale * 2.5f, color, 40);
-            draw_list->AddCircleFilled(ImVec2(pos.x + (scale * 17.0f), pos.y + (scale * 4.0f)), scale * 2.5f, color, 40);
-            draw_list->AddCircleFilled(ImVec2(pos.x + (scale * 4.0f), pos.y + (scale * 17.0f)), scale * 2.5f, color, 40);
-            break;
-        case 5:
-            draw_list->AddCircleFilled(ImVec2(pos.x + (scale * 4.0f), pos.y + (scale * 4.0f)), scale * 2.5f, color, 40);
-            draw_list->AddCircleFilled(ImVec2(pos.x + (scale * 17.0f), pos.y + (scale * 17.0f)), scale * 2.5f, color, 40);
-            draw_list->AddCircleFilled(ImVec2(pos.x + (scale * 10.5f), pos.y + (scale * 10.5f)), scale * 2.5f, color, 40);
-            draw_list->AddCircleFilled(ImVec2(pos.x + (scale * 17.0f), pos.y + (scale * 4.0f)), scale * 2.5f, color, 40);
-            draw_list->AddCircleFilled(ImVec2(pos.x + (scale * 4.0f), pos.y + (scale * 17.0f)), scale * 2.5f, color, 40);
-            break;
-        case 6:
-            if (vertical) {
-                draw_list->AddCircleFilled(ImVec2(pos.x + (scale * 4.0f), pos.y + (scale * 4.0f)), scale * 2.5f, color, 40);
-                draw_list->AddCircleFilled(ImVec2(pos.x + (scale * 4.0f), pos.y + (scale * 10.5f)), scale * 2.5f, color, 40);
-                draw_list->AddCircleFilled(ImVec2(pos.x + (scale * 17.0f), pos.y + (scale * 17.0f)), scale * 2.5f, color, 40);
-                draw_list->AddCircleFilled(ImVec2(pos.x + (scale * 17.0f), pos.y + (scale * 4.0f)), scale * 2.5f, color, 40);
-                draw_list->AddCircleFilled(ImVec2(pos.x + (scale * 17.0f), pos.y + (scale * 10.5f)), scale * 2.5f, color, 40);
-                draw_list->AddCircleFilled(ImVec2(pos.x + (scale * 4.0f), pos.y + (scale * 17.0f)), scale * 2.5f, color, 40);
-            }
-            else {
-                draw_list->AddCircleFilled(ImVec2(pos.x + (scale * 4.0f), pos.y + (scale * 4.0f)), scale * 2.5f, color, 40);
-                draw_list->AddCircleFilled(ImVec2(pos.x + (scale * 10.5f), pos.y + (scale * 4.0f)), scale * 2.5f, color, 40);
-                draw_list->AddCircleFilled(ImVec2(pos.x + (scale * 17.0f), pos.y + (scale * 17.0f)), scale * 2.5f, color, 40);
-                draw_list->AddCircleFilled(ImVec2(pos.x + (scale * 17.0f), pos.y + (scale * 4.0f)), scale * 2.5f, color, 40);
-                draw_list->AddCircleFilled(ImVec2(pos.x + (scale * 10.5f), pos.y + (scale * 17.0f)), scale * 2.5f, color, 40);
-                draw_list->AddCircleFilled(ImVec2(pos.x + (scale * 4.0f), pos.y + (scale * 17.0f)), scale * 2.5f, color, 40);
-            }
-            break;
-        default:
-            break;
-        }
-    }
-    // Draw the right side of the domino. Vertically, it's the lower side.
-    static void rightDotNumber(uint16_t number, float leftWidth, const ImVec2& pos, float scale, ImU32 col, bool vertical = false)
-    {
-        auto new_pos = vertical ? ImVec2(pos.x, pos.y + leftWidth) : ImVec2(pos.x + leftWidth, pos.y);
-        leftDotNumber(number, new_pos, scale, col, vertical);
-    }
-    // Draw the line between the left and right/up and down side.
-    static void middleLine(float leftWidth, const ImVec2& pos, float scale, ImU32 col, bool vertical = false)
-    {
-        ImDrawList* draw_list = ImGui::GetWindowDrawList();
-        if (vertical) {
-            draw_list->AddRectFilled(ImVec2((1.5f * scale) + pos.x, leftWidth - (scale * 0.55f) + pos.y), ImVec2(pos.x + (19.5f * scale), leftWidth + pos.y + (scale * 0.55f)), col, 0.0f);
-        }
-        else {
-            draw_list->AddRectFilled(ImVec2(leftWidth - (scale * 0.55f) + pos.x, pos.y + (1.5f * scale)), ImVec2(leftWidth + pos.x + (scale * 0.55f), pos.y + (19.5f * scale)), col, 0.0f);
-        }
-    }
-}
-
-Domino2D::Domino2D(uint16_t leftnumber, uint16_t rightnumber)
-{
-    CreateTile(leftnumber, rightnumber);
-}
-
-//---------------------------
-// STATIC FUNCTIONS
-//---------------------------
-
-void Domino2D::InitiateDominoStatics(float tile_h, ImU32 tile_col, ImU32 dot_col)
-{
-    TileHeight = tile_h;
-    TileWidth = (TileHeight * 2) + 1;
-    TileScale = TileHeight / 21.0f;
-    TileLeftWidth = TileHeight + 1;
-    TileVecSize = ImVec2(TileWidth, TileHeight);
-    TileColor = tile_col;
-    DotColor = dot_col;
-}
-
-void Domino2D::InitiateDominoStatics(float tile_h, const ImVec4& tile_col, const ImVec4& dot_col)
-{
-    InitiateDominoStatics(tile_h, ImGui::ColorConvertFloat4ToU32(tile_col), ImGui::ColorConvertFloat4ToU32(dot_col));
-}
-
-void Domino2D::ChangeColors(ImU32 tile_col, ImU32 dot_col)
-{
-    TileColor = tile_col;
-    DotColor = dot_col;
-}
-
-void Domino2D::ChangeColors(const ImVec4& tile_col, const ImVec4& dot_col)
-{
-    TileColor = ImGui::ColorConvertFloat4ToU32(tile_col);
-    DotColor = ImGui::ColorConvertFloat4ToU32(dot_col);
-}
-
-void Domino2D::ChangeSize(float tile_h)
-{
-    TileHeight = tile_h;
-    TileWidth = (TileHeight * 2) + 1;
-    TileScale = TileHeight / 21.0f;
-    TileLeftWidth = TileHeight + 1;
-    TileVecSize = ImVec2(TileWidth, TileHeight);
-}
-
-ImU32& Domino2D::GetTileColor()
-{
-    return TileColor;
-}
-
-ImU32& Domino2D::GetDotColor()
-{
-    return DotColor;
-}
-
-ImVec2& Domino2D::GetDimensions()
-{
-    return TileVecSize;
-}
-
-//---------------------------
-// NON-STATIC FUNCTIONS
-//---------------------------
-
-void Domino2D::CreateTile(uint16_t leftnumber, uint16_t rightnumber)
-{
-    MirrorTile        = false;
-    removed           = false;
-    left_number       = leftnumber;
-    right_number      = rightnumber;
-    left_connectable  = true;
-    right_connectable = true;
-    TileOrientation   = TileOrientation_Horizontal;
-    TilePos           = ImVec2(0, 0);
-}
-
-ImVec2 Domino2D::GetPos() const
-{
-    return TilePos;
-}
-
-uint16_t Domino2D::GetTileNumber() const
-{
-    return (left_number * 10) + right_number;
-}
-
-bool Domino2D::SetAsFirstDomino()
-{
-    const ImVec2& window = ImGui::GetWindowContentRegionMax();
-    if (this->IsDoubleNumber()) {
-        TilePos = (window / 2.0f) - ImVec2(TileHeight / 2.0f, TileWidth / 2.0f) + ImVec2(0.0f, 20.0f);
-        TileOrientation = TileOrientation_Vertical;
-    }
-    else {
-        TilePos = (window / 2.0f) - ImVec2(TileWidth / 2.0f, TileHeight / 2.0f) + ImVec2(0.0f, 20.0f);
-        TileOrientation = TileOrientation_Horizontal;
-    }
-
-    removed = true;
-    return true;
-}
-
-void Domino2D::ChangeLeftNumConnection(bool connectable)
-{
-    this->left_connectable = connectable;
-}
-
-void Domino2D::ChangeRightNumConnection(bool connectable)
-{
-    this->right_connectable = connectable;
-}
-
-bool Domino2D::IsLeftConnectable() const
-{
-    return left_connectable;
-}
-
-bool Domino2D::IsRightConnectable() const
-{
-    return right_connectable;
-}
-
-void Domino2D::ResetParameters()
-{
-    TilePos           = ImVec2(0, 0);
-    MirrorTile        = false;
-    left_connectable  = true;
-    right_connectable = true;
-    removed           = false;
-    TileOrientation   = TileOrientation_Horizontal;
-}
-
-void Domino2D::ChangePosition(float plus_x, float plus_y)
-{
-    TilePos.x += plus_x;
-    TilePos.y += plus_y;
-}
-
-bool Domino2D::ConnectDominoOnLeft(Domino2D& DominoConnectee)
-{
-    const uint16_t& ConnecteeLeftNumber = DominoConnectee.MirrorTile ? DominoConnectee.GetRightNumber() : DominoConnectee.GetLeftNumber();
-
-    if (this->GetRightNumber() == ConnecteeLeftNumber) {
-        this->MirrorTile = false;
-        this->ChangeRightNumConnection(false);
-    }
-    else if (this->GetLeftNumber() == ConnecteeLeftNumber) {
-        this->MirrorTile = true;
-        this->ChangeLeftNumConnection(false);
-    }
-    else {
-        return false;
-    }
-
-    if (DominoConnectee.IsDoubleNumber()) {
-        if (dvars::GameState.LeftSideSize() == 5) {
-            DominoConnectee.TilePos.x = DominoConnectee.TilePos.x - TileHeight;
-            DominoConnectee.TilePos.y = DominoConnectee.TilePos.y + (TileWidth / 2.0f) - (TileHeight / 2.0f);
-            DominoConnectee.TileOrientation = TileOrientation_Horizontal;
-            TilePos.x = DominoConnectee.TilePos.x - TileHeight;
-            TilePos.y = DominoConnectee.TilePos.y - TileHeight;
-            TileOrientation = TileOrientation_Vertical;
-        }
-        else if (dvars::GameState.LeftSideSize() == 6) {
-            TilePos.x = DominoConnectee.TilePos.x;
-            TilePos.y = DominoConnectee.TilePos.y - TileWidth;
-            TileOrientation = TileOrientation_Vertical;
-        }
-        else if (dvars::GameState.LeftSideSize() == 7) {
-            TilePos.x = DominoConnectee.TilePos.x;
-            TilePos.y = DominoConnectee.TilePos.y - TileHeight;
-            TileOrientation = TileOrientation_Horizontal;
-        }
-        else if (dvars::GameState.LeftSideSize() == 8) {
-            TilePos.x = DominoConnectee.TilePos.x + TileWidth;
-            TilePos.y = DominoConnectee.TilePos.y;
-            TileOrientation = TileOrientation_Horizontal;
-        }
-        else if (DominoConnectee.TileOrientation == TileOrientation_Horizontal) {
-            TilePos.x = DominoConnectee.TilePos.x + (TileWidth / 2.0f) - (TileHeight / 2.0f);
-            TilePos.y = DominoConnectee.TilePos.y - TileWidth;
-            TileOrientation = TileOrientation_Vertical;
-        }
-        else {
-            if (dvars::GameState.LeftSideSize() > 8) {
-                TilePos.x = DominoConnectee.TilePos.x + TileHeight;
-                TilePos.y = DominoConnectee.TilePos.y + (TileWidth / 2.0f) - (TileHeight / 2.0f);
-            }
-            else {
-                TilePos.x = DominoConnectee.TilePos.x - TileWidth;
-                TilePos.y = DominoConnectee.TilePos.y + (TileWidth / 2.0f) - (TileHeight / 2.0f);
-            }
-            TileOrientation = TileOrientation_Horizontal;
-        }
-    }
-    else if (this->IsDoubleNumber()) {
-        if (dvars::GameState.LeftSideSize() == 5) {
-            TilePos.x = DominoConnectee.TilePos.x - TileHeight;
-            TilePos.y = DominoConnectee.TilePos.y - (TileWidth / 2.0f);
-            TileOrientation = TileOrientation_Vertical;
-        }
-        else if (dvars::GameState.LeftSideSize() == 6) {
-            TilePos.x = DominoConnectee.TilePos.x;
-            TilePos.y = DominoConnectee.TilePos.y - TileWidth;
-            TileOrientation = TileOrientation_Vertical;
-        }
-        else if (dvars::GameState.LeftSideSize() == 7) {
-            TilePos.x = DominoConnectee.TilePos.x;
-            TilePos.y = DominoConnectee.TilePos.y - TileHeight;
-            TileOrientation = TileOrientation_Horizontal;
-        }
-        else if (DominoConnectee.TileOrientation == TileOrientation_Horizontal) {
-            if (dvars::GameState.LeftSideSize() > 7) {
-                TilePos.x = DominoConnectee.TilePos.x + TileWidth;
-                TilePos.y = DominoConnectee.TilePos.y - (TileWidth / 2.0f) + (TileHeight / 2.0f);
-            }
-            else {
-                TilePos.x = DominoConnectee.TilePos.x - TileHeight;
-                TilePos.y = DominoConnectee.TilePos.y - (TileWidth / 2.0f) + (TileHeight / 2.0f);
-            }
-            TileOrientation = TileOrientation_Vertical;
-        }
-        else {
-            TilePos.x = DominoConnectee.TilePos.x - (TileWidth / 2.0f) + (TileHeight / 2.0f);
-            TilePos.y = DominoConnectee.TilePos.y - TileHeight;
-            TileOrientation = TileOrientation_Horizontal;
-        }
-    }
-    else {
-        if (dvars::GameState.LeftSideSize() == 5) {
-            TilePos.x = DominoConnectee.TilePos.x - TileHeight;
-            TilePos.y = DominoConnectee.TilePos.y - (TileWidth / 2.0f);
-            TileOrientation = TileOrientation_Vertical;
-        }
-        else if (dvars::GameState.LeftSideSize() == 6) {
-            TilePos.x = DominoConnectee.TilePos.x;
-            TilePos.y = DominoConnectee.TilePos.y - TileWidth;
-            TileOrientation = TileOrientation_Vertical;
-        }
-        else if (dvars::GameState.LeftSideSize() == 7) {
-            TilePos.x = DominoConnectee.TilePos.x;
-            TilePos.y = DominoConnectee.TilePos.y - TileHeight;
-            TileOrientation = TileOrientation_Horizontal;
-        }
-        else if (DominoConnectee.TileOrientation == TileOrientation_Vertical) {
-            TilePos.x = DominoConnectee.TilePos.x;
-            TilePos.y = DominoConnectee.TilePos.y - TileWidth;
-            TileOrientation = TileOrientation_Vertical;
-        }
-        else {
-            if (dvars::GameState.LeftSideSize() > 7) {
-                TilePos.x = DominoConnectee.TilePos.x + TileWidth;
-                TilePos.y = DominoConnectee.TilePos.y;
-            }
-            else {
-                TilePos.x = DominoConnectee.TilePos.x - TileWidth;
-                TilePos.y = DominoConnectee.TilePos.y;
-            }
-            TileOrientation = TileOrientation_Horizontal;
-        }
-    }
-
-    this->removed = true;
-    DominoConnectee.MirrorTile ? DominoConnectee.ChangeRightNumConnection(false) : DominoConnectee.ChangeLeftNumConnection(false);
-    return true;
-}
-
-bool Domino2D::ConnectDominoOnRight(Domino2D& DominoConnectee)
-{
-    const uint16_t& RightNumber          = this->GetRightNumber();
-    const uint16_t& LeftNumber           = this->GetLeftNumber();
-    const uint16_t& ConnecteeRightNumber = DominoConnectee.MirrorTile ? DominoConnectee.GetLeftNumber() : DominoConnectee.GetRightNumber();
-
-    if (RightNumber == ConnecteeRightNumber) {
-        MirrorTile = true;
-        this->ChangeRightNumConnection(false);
-    }
-    else if (LeftNumber == ConnecteeRightNumber) {
-        MirrorTile = false;
-        this->ChangeLeftNumConnection(false);
-    }
-    else {
-        return false;
-    }
-
-    if (DominoConnectee.IsDoubleNumber()) {
-        if (dvars::GameState.RightSideSize() == 5) {
-            DominoConnectee.TilePos.x = DominoConnectee.TilePos.x;
-            DominoConnectee.TilePos.y = DominoConnectee.TilePos.y + (TileWidth / 2.0f) - (TileHeight / 2.0f);
-            DominoConnectee.TileOrientation = TileOrientation_Horizontal;
-            TilePos.x = DominoConnectee.TilePos.x + TileWidth;
-            TilePos.y = DominoConnectee.TilePos.y;
-            TileOrientation = TileOrientation_Vertical;
-        }
-        else if (dvars::GameState.RightSideSize() == 6) {
-            TilePos.x = DominoConnectee.TilePos.x;
-            TilePos.y = DominoConnectee.TilePos.y + TileWidth;
-            TileOrientation = TileOrientation_Vertical;
-        }
-        else if (dvars::GameState.RightSideSize() == 7) {
-            TilePos.x = DominoConnectee.TilePos.x - (TileWidth / 2.0f);
-            TilePos.y = DominoConnectee.TilePos.y + TileWidth;
-            TileOrientation = TileOrientation_Horizontal;
-        }
-        else if (dvars::GameState.RightSideSize() == 8) {
-            TilePos.x = DominoConnectee.TilePos.x - TileWidth;
-            TilePos.y = DominoConnectee.TilePos.y;
-            TileOrientation = TileOrientation_Horizontal;
-        }
-        else if (DominoConnectee.TileOrientation == TileOrientation_Horizontal) {
-            TilePos.x = DominoConnectee.TilePos.x + (TileWidth / 2.0f) - (TileHeight / 2.0f);
-            TilePos.y = DominoConnectee.TilePos.y + TileHeight;
-            TileOrientation = TileOrientation_Vertical;
-        }
-        else {
-            if (dvars::GameState.LeftSideSize() > 8) {
-                TilePos.x = DominoConnectee.TilePos.x - TileWidth;
-                TilePos.y = DominoConnectee.TilePos.y + (TileWidth / 2.0f) - (TileHeight / 2.0f);
-            }
-            else {
-                TilePos.x = DominoConnectee.TilePos.x + TileHeight;
-                TilePos.y = DominoConnectee.TilePos.y + (TileWidth / 2.0f) - (TileHeight / 2.0f);
-            }
-            TileOrientation = TileOrientation_Horizontal;
-        }
-    }
-    else if (this->IsDoubleNumber()) {
-        if (dvars::GameState.RightSideSize() == 5) {
-            TilePos.x = DominoConnectee.TilePos.x + TileWidth;
-            TilePos.y = DominoConnectee.TilePos.y;
-            TileOrientation = TileOrientation_Vertical;
-        }
-        else if (dvars::GameState.RightSideSize() == 6) {
-            TilePos.x = DominoConnectee.TilePos.x;
-            TilePos.y = DominoConnectee.TilePos.y + TileWidth;
-            TileOrientation = TileOrientation_Vertical;
-        }
-        else if (dvars::GameState.RightSideSize() == 7) {
-            TilePos.x = DominoConnectee.TilePos.x - (TileWidth / 2.0f);
-            TilePos.y = DominoConnectee.TilePos.y + TileWidth;
-            TileOrientation = TileOrientation_Horizontal;
-        }
-        else if (DominoConnectee.TileOrientation == TileOrientation_Horizontal) {
-            if (dvars::GameState.RightSideSize() > 7) {
-                TilePos.x = DominoConnectee.TilePos.x - TileHeight;
-                TilePos.y = DominoConnectee.TilePos.y - (TileWidth / 2.0f) + (TileHeight / 2.0f);
-            }
-            else {
-                TilePos.x = DominoConnectee.TilePos.x + TileWidth;
-                TilePos.y = DominoConnectee.TilePos.y - (TileWidth / 2.0f) + (TileHeight / 2.0f);
-            }
-            TileOrientation = TileOrientation_Vertical;
-        }
-        else {
-            TilePos.x = DominoConnectee.TilePos.x - (TileWidth / 2.0f) + (TileHeight / 2.0f);
-            TilePos.y = DominoConnectee.TilePos.y + TileWidth;
-            TileOrientation = TileOrientation_Horizontal;
-        }
-    }
-    else {
-        if (dvars::GameState.RightSideSize() == 5) {
-            TilePos.x = DominoConnectee.TilePos.x + TileWidth;
-            TilePos.y = DominoConnectee.TilePos.y;
-            TileOrientation = TileOrientation_Vertical;
-        }
-        else if (dvars::GameState.RightSideSize() == 6) {
-            TilePos.x = DominoConnectee.TilePos.x;
-            TilePos.y = DominoConnectee.TilePos.y + TileWidth;
-            TileOrientation = TileOrientation_Vertical;
-        }
-        else if (dvars::GameState.RightSideSize() == 7) {
-            TilePos.x = DominoConnectee.TilePos.x - (TileWidth / 2.0f);
-            TilePos.y = DominoConnectee.TilePos.y + TileWidth;
-            TileOrientation = TileOrientation_Horizontal;
-        }
-        else if (DominoConnectee.TileOrientation == TileOrientation_Vertical) {
-            TilePos.x = DominoConnectee.TilePos.x;
-            TilePos.y = DominoConnectee.TilePos.y + TileWidth;
-        }
-        else {
-            if (dvars::GameState.RightSideSize() > 7) {
-                TilePos.x = DominoConnectee.TilePos.x - TileWidth;
-                TilePos.y = DominoConnectee.TilePos.y;
-            }
-            else {
-                TilePos.x = DominoConnectee.TilePos.x + TileWidth;
-                TilePos.y = DominoConnectee.TilePos.y;
-            }
-            TileOrientation = TileOrientation_Horizontal;
-        }
-    }
-    // Changes the current tile status to removed and the connectee's corresponding tile unconnectable
-    this->removed = true;
-    DominoConnectee.MirrorTile ? DominoConnectee.ChangeLeftNumConnection(false) : DominoConnectee.ChangeRightNumConnection(false);
-    return true;
-}
-
-bool Domino2D::ConnectDomino(Domino2D& DominoConnectee, int drop_pos)
-{
-    const auto& connectable = drop_pos == TileDropPosition_Left ?  (!DominoConnectee.MirrorTile ? DominoConnectee.IsLeftConnectable() : DominoConnectee.IsRightConnectable()) :
-                                                                   (DominoConnectee.MirrorTile ? DominoConnectee.IsLeftConnectable() : DominoConnectee.IsRightConnectable());
-    if (!connectable) {
-        return false;
-    }
-
-    if (drop_pos == TileDropPosition_Left) {
-        return ConnectDominoOnLeft(DominoConnectee);
-    }
-
-    if (drop_pos >= TileDropPosition_Right) {
-        return ConnectDominoOnRight(DominoConnectee);
-    }
-
-    return false;
-}
-
-bool Domino2D::PseudoConnectDomino(Domino2D& DominoConnectee) const
-{
-    if (!DominoConnectee.IsLeftConnectable() && !DominoConnectee.IsRightConnectable()) {
-        return false;
-    }
-
-    const bool& leftconnect = DominoConnectee.MirrorTile ? DominoConnectee.IsRightConnectable() : DominoConnectee.IsLeftConnectable();
-    const bool& rightconnect = DominoConnectee.MirrorTile ? DominoConnectee.IsLeftConnectable() : DominoConnectee.IsRightConnectable();
-    const uint16_t& RightNumber = this->GetRightNumber();
-    const uint16_t& LeftNumber  = this->GetLeftNumber();
-    const uint16_t& ConnecteeLeftNumber  = DominoConnectee.MirrorTile ? DominoConnectee.GetRightNumber() : DominoConnectee.GetLeftNumber();
-    const uint16_t& ConnecteeRightNumber = DominoConnectee.MirrorTile ? DominoConnectee.GetLeftNumber()  : DominoConnectee.GetRightNumber();
-
-    //if (DominoConnectee.TileNumbers.IsDoubleNumber()) [[unlikely]] {
-    //    connect1 = RightNumber == ConnecteeLeftNumber || LeftNumber == ConnecteeRightNumber;
-    //}
-
-    bool connect1 = (RightNumber == ConnecteeLeftNumber  && leftconnect)  || (LeftNumber == ConnecteeRightNumber && rightconnect);
-    bool connect2 = (RightNumber == ConnecteeRightNumber && rightconnect) || (LeftNumber == ConnecteeLeftNumber  && leftconnect);
-
-    return connect1 || connect2;
-}
-
-bool Domino2D::TileButton(const char* label, bool OverrideMirror, ImGuiButtonFlags flags) const
-{
-    using namespace ImGui;
-    ImGuiWindow* window = GetCurrentWindow();
-    if (window->SkipItems)
-        return false;
-
-    ImGuiContext& g = *GImGui;
-    const ImGuiStyle& style = g.Style;
-    const ImGuiID id = window->GetID(label);
-    const ImVec2 label_size = CalcTextSize(label, NULL, true);
-    const bool Mirror = OverrideMirror ? !MirrorTile : MirrorTile;
-
-    ImVec2 pos = TilePos;
-    ImVec2 size = CalcItemSize(TileOrientation == TileOrientation_Vertical ? ImVec2(TileVecSize.y, TileVecSize.x) : TileVecSize, label_size.x + style.FramePadding.x * 2.0f, label_size.y + style.FramePadding.y * 2.0f);
-
-    const ImRect bb(pos, pos + size);
-    ItemSize(size, style.FramePadding.y);
-    if (!ItemAdd(bb, id))
-        return false;
-
-    if (g.LastItemData.InFlags & ImGuiItemFlags_ButtonRepeat)
-        flags |= ImGuiButtonFlags_Repeat;
-
-    bool hovered, held;
-    bool pressed = ButtonBehavior(bb, id, &hovered, &held, flags);
-
-    // Render
-    //const ImU32 col = held && hovered ? GetColorU32(ImGuiCol_ButtonActive) : (hovered ? GetColorU32(ImGuiCol_ButtonHovered) : TileColor);
-    const ImU32 col = GetColorU32((held && hovered) ? ImGuiCol_ButtonActive : hovered ? ImGuiCol_ButtonHovered : ImGuiCol_Button);
-
-    RenderNavHighlight(bb, id);
-    RenderFrame(bb.Min, bb.Max, col, true, 3.0f * TileScale);
-
-    if (g.LogEnabled)
-        LogSetNextTextDecoration("[", "]");
-
-    domino_dots::leftDotNumber(Mirror ? right_number : left_number, pos, TileScale, DotColor, TileOrientation);
-    domino_dots::middleLine(TileLeftWidth, pos, TileScale, DotColor, TileOrientation);
-    domino_dots::rightDotNumber(Mirror ? left_number : right_number, TileLeftWidth, pos, TileScale, DotColor, TileOrientation);
-
-    // Automatically close popups
-    //if (pressed && !(flags & ImGuiButtonFlags_DontClosePopups) && (window->Flags & ImGuiWindowFlags_Popup))
-    //    CloseCurrentPopup();
-
-    IMGUI_TEST_ENGINE_ITEM_INFO(id, label, g.LastItemData.StatusFlags);
-    return pressed;
-}
-
-bool Domino2D::RenderTile(const char* label, bool OverrideMirror, ImGuiButtonFlags flags) const
-{
-    ImGui::PushStyleColor(ImGuiCol_Button, TileColor);
-    if (TileButton(label, OverrideMirror, flags)) {
-        ImGui::PopStyleColor();
-        return true;
-    }
-    ImGui::PopStyleColor();
-    return false;
-}
-
-bool Domino2D::RenderTransparentTile(const char* label, bool OverrideMirror, ImGuiButtonFlags flags) const
-{
-    using namespace ImGui;
-    ImGuiWindow* window = GetCurrentWindow();
-    if (window->SkipItems)
-        return false;
-
-    ImGuiContext& g = *GImGui;
-    const ImGuiStyle& style = g.Style;
-    const ImGuiID id = window->GetID(label);
-    const ImVec2 label_size = CalcTextSize(label, NULL, true);
-
-    ImVec2 pos = TilePos;
-    ImVec2 size = CalcItemSize(TileOrientation == TileOrientation_Vertical ? ImVec2(TileVecSize.y, TileVecSize.x) : TileVecSize, label_size.x + style.FramePadding.x * 2.0f, label_size.y + style.FramePadding.y * 2.0f);
-
-    const ImRect bb(pos, pos + size);
-    ItemSize(size, style.FramePadding.y);
-    if (!ItemAdd(bb, id))
-        return false;
-
-    if (g.LastItemData.InFlags & ImGuiItemFlags_ButtonRepeat)
-        flags |= ImGuiButtonFlags_Repeat;
-
-    bool hovered, held;
-    bool pressed = ButtonBehavior(bb, id, &hovered, &held, flags);
-
-    constexpr ImU32 tile_transparent_color = 2197815295;
-    constexpr ImU32 dot_transparent_color = 2181038080;
-    const bool Mirror = OverrideMirror ? !MirrorTile : MirrorTile;
-
-    // Render
-    const ImU32 col = held && hovered ? GetColorU32(ImGuiCol_ButtonActive) : (hovered ? GetColorU32(ImGuiCol_ButtonHovered) : tile_transparent_color);
-    RenderNavHighlight(bb, id);
-    RenderFrame(bb.Min, bb.Max, col, true, 3.0f * TileScale);
-
-    if (g.LogEnabled)
-        LogSetNextTextDecoration("[", "]");
-
-    domino_dots::leftDotNumber(Mirror ? right_number : left_number, pos, TileScale, dot_transparent_color, TileOrientation);
-    domino_dots::middleLine(TileLeftWidth, pos, TileScale, dot_transparent_color, TileOrientation);
-    domino_dots::rightDotNumber(Mirror ? left_number : right_number, TileLeftWidth, pos, TileScale, dot_transparent_color, TileOrientation);
-
-    // Automatically close popups
-    //if (pressed && !(flags & ImGuiButtonFlags_DontClosePopups) && (window->Flags & ImGuiWindowFlags_Popup))
-    //    CloseCurrentPopup();
-
-    IMGUI_TEST_ENGINE_ITEM_INFO(id, label, g.LastItemData.StatusFlags);
-    return pressed;
-}
-
-bool Domino2D::RenderTileIndependently(const char* label, const ImVec2& sz, const ImVec2& position, ImGuiButtonFlags flags) const
-{
-    using namespace ImGui;
-    ImGuiWindow* window = GetCurrentWindow();
-    if (window->SkipItems)
-        return false;
-
-    ImGuiContext& g = *GImGui;
-    const ImGuiStyle& style = g.Style;
-    const ImGuiID id = window->GetID(label);
-    const ImVec2 label_size = CalcTextSize(label, NULL, true);
-
-    ImVec2 pos = position;
-    if ((flags & ImGuiButtonFlags_AlignTextBaseLine) && style.FramePadding.y < window->DC.CurrLineTextBaseOffset) // Try to vertically align buttons that are smaller/have no padding so that text baseline matches (bit hacky, since it shouldn't be a flag)
-        pos.y += window->DC.CurrLineTextBaseOffset - style.FramePadding.y;
-    ImVec2 size = CalcItemSize(sz, label_size.x + style.FramePadding.x * 2.0f, label_size.y + style.FramePadding.y * 2.0f);
-
-    const ImRect bb(pos, pos + size);
-    ItemSize(size, style.FramePadding.y);
-    if (!ItemAdd(bb, id))
-        return false;
-
-    if (g.LastItemData.InFlags & ImGuiItemFlags_ButtonRepeat)
-        flags |= ImGuiButtonFlags_Repeat;
-
-    bool hovered, held;
-    bool pressed = ButtonBehavior(bb, id, &hovered, &held, flags);
-
-    // Render
-    //const ImU32 col = GetColorU32((held && hovered) ? ImGuiCol_ButtonActive : hovered ? ImGuiCol_ButtonHovered : ImGuiCol_Button);
-    const ImU32 col = held && hovered ? GetColorU32(ImGuiCol_ButtonActive) : (hovered ? GetColorU32(ImGuiCol_ButtonHovered) : TileColor);
-
-    const float scale = size.y / 21.0f;
-    const float halfwidth = size.y + 1;
-
-    RenderNavHighlight(bb, id);
-    RenderFrame(bb.Min, bb.Max, col, true, 3.0f * scale);
-
-    if (g.LogEnabled)
-        LogSetNextTextDecoration("[", "]");
-
-
-    domino_dots::leftDotNumber(left_number, pos, scale, DotColor, TileOrientation_Horizontal);
-    domino_dots::middleLine(halfwidth, pos, scale, DotColor, TileOrientation_Horizontal);
-    domino_dots::rightDotNumber(right_number, halfwidth, pos, scale, DotColor, TileOrientation_Horizontal);
-
-    // Automatically close popups
-    //if (pressed && !(flags & ImGuiButtonFlags_DontClosePopups) && (window->Flags & ImGuiWindowFlags_Popup))
-    //    CloseCurrentPopup();
-
-    IMGUI_TEST_ENGINE_ITEM_INFO(id, label, g.LastItemData.StatusFlags);
-    return pressed;
-}
-
-constexpr bool Domino2D::operator == (const Domino2D& DT) const
-{
-    return (left_number == DT.left_number && right_number == DT.right_number) || (right_number == DT.left_number && left_number == DT.right_number);
-}
-
-constexpr bool Domino2D::operator == (const DominoTile& other) const
-{
-    return (left_number == other.GetLeftNumber() && right_number == other.GetRightNumber()) || (right_number == other.GetLeftNumber() && left_number == other.GetRightNumber());
-}
-
-
-
-
-//-----------------------------------------------------------------------------------------------------------------------
-// PlayerDomino2D CLASS
-//-----------------------------------------------------------------------------------------------------------------------
-
-PlayerDomino2D::PlayerDomino2D(uint16_t player_number)
-{
-    this->PlayerNumber = player_number;
-}
-
-bool PlayerDomino2D::InitializePlayerDomino()
-{
-    if (this->PlayerNumber >= 8) {
-        return false;
-    }
-
-    return true;
-}
-
-void PlayerDomino2D::InitializeDominoParameters()
-{
-    TileColor       = &Domino2D::GetTileColor();
-    DotColor        = &Domino2D::GetDotColor();
-    ClickedColor    = 3432598886;
-    TileSize        = ImVec2(141.0f, 70.0f);
-    scale           = 70.0f / 21.0f;
-    HalfWidth       = 71.0f;
-    TilePositioning = ImVec2(23.0f, 540.0f);
-
-}
-
-bool PlayerDomino2D::PlayerDominoButton(Domino2D& DT, const char* label, const ImVec2& position, ImGuiButtonFlags flags)
-{
-    using namespace ImGui;
-    ImGuiWindow* window = GetCurrentWindow();
-    if (window->SkipItems)
-        return false;
-
-    ImGuiContext& g = *GImGui;
-    const ImGuiStyle& style = g.Style;
-    const ImGuiID id = window->GetID(label);
-    const ImVec2 label_size = CalcTextSize(label, NULL, true);
-
-    ImVec2 pos = position;
-    ImVec2 size = CalcItemSize(TileSize, label_size.x + style.FramePadding.x * 2.0f, label_size.y + style.FramePadding.y * 2.0f);
-
-    const ImRect bb(pos, pos + size);
-    ItemSize(size, style.FramePadding.y);
-    if (!ItemAdd(bb, id))
-        return false;
-
-    if (g.LastItemData.InFlags & ImGuiItemFlags_ButtonRepeat)
-        flags |= ImGuiButtonFlags_Repeat;
-
-    bool hovered, held;
-    bool pressed = ButtonBehavior(bb, id, &hovered, &held, flags);
-
-    // Render
-    //const ImU32 col = held && hovered ? GetColorU32(ImGuiCol_ButtonActive) : (hovered ? GetColorU32(ImGuiCol_ButtonHovered) : (DT.Clicked ? ClickedColor : *TileColor));
-    bool tile_selected = CurrentlyClickedCard == &DT;
-    const ImU32 col = (held && hovered) ? GetColorU32(ImGuiCol_ButtonActive) : hovered ? GetColorU32(ImGuiCol_ButtonHovered) : (tile_selected ? ClickedColor : GetColorU32(ImGuiCol_Button));
-
-    RenderNavHighlight(bb, id);
-    RenderFrame(bb.Min, bb.Max, col, true, 3.0f * scale);
-
-    if (g.LogEnabled)
-        LogSetNextTextDecoration("[", "]");
-
-    domino_dots::leftDotNumber(DT.GetLeftNumber(), pos, scale, *DotColor);
-    domino_dots::middleLine(HalfWidth, pos, scale, *DotColor);
-    domino_dots::rightDotNumber(DT.GetRightNumber(), HalfWidth, pos, scale, *DotColor);
-
-    // Automatically close popups
-    //if (pressed && !(flags & ImGuiButtonFlags_DontClosePopups) && (window->Flags & ImGuiWindowFlags_Popup))
-    //    CloseCurrentPopup();
-
-    IMGUI_TEST_ENGINE_ITEM_INFO(id, label, g.LastItemData.StatusFlags);
-    return pressed;
-
-    return true;
-}
-
-void PlayerDomino2D::ClearDominoes()
-{
-    PlayerCards.clear();
-}
-
-bool PlayerDomino2D::RenderPlayerDominoes()
-{
-    bool clicked    = false;
-    auto& dgs       = dvars::GameState;
-    ImVec2 position = TilePositioning;
-    bool first_tile_state = dgs.IsThereAChangeInPlayer() && dgs.GetNumberOfTurns() == 0;
-
-    for (size_t iter = 0; auto DT : PlayerCards) {
-        if (!DT->IsRemoved()) {
-            static const char* Label[] = { "PDB##1", "PDB##2", "PDB##3", "PDB##4", "PDB##5" };
-
-            ImGui::SameLine();
-            ImGui::BeginDisabled(first_tile_state && dgs.GetFirstTurnTile() != *DT); // Disable the tile in the first turn if it's not the first tile that needs to be used
-            ImGui::PushStyleColor(ImGuiCol_Button, *TileColor);
-            if (PlayerDominoButton(*DT, Label[iter], position)) {
-                clicked = true;
-                CurrentlyClickedCard = CurrentlyClickedCard == nullptr ? DT : (CurrentlyClickedCard == DT ? nullptr : DT);
-            }
-            if (ImGui::IsItemHovered() && first_tile_state && dgs.GetFirstTurnTile() == *DT) {
-                ImGui::BeginTooltip();
-                ImGui::PushTextWrapPos(150.0f);
-                ImGui::TextUnformatted("FIRST TURN TILE USE");
-                ImGui::PopTextWrapPos();
-                ImGui::EndTooltip();
-            }
-            ImGui::PopStyleColor();
-            ImGui::EndDisabled();
-        }
-
-        position = ImVec2(position.x + 152.0f, position.y);
-        iter++;
-    }
-
-    return clicked;
-}
-
-// FOR DEBUGGING PURPOSES
-#ifdef _DEBUG
-void PlayerDomino2D::ChangeTilePositioning(float _x, float _y)
-{
-    TilePositioning = ImVec2(_x, _y);
-}
-
-ImVec2 PlayerDomino2D::GetTilePosition()
-{
-    return TilePositioning;
-}
-#endif // DEBUG
-
-
-
-
-//-----------------------------------------------------------------------------------------------------------------------
-// GameBoardDominoes CLASS
-//-----------------------------------------------------------------------------------------------------------------------
-
-void GameBoardDominoes::AddFirstDomino(Domino2D& d)
-{
-    FirstDomino = &d;
-}
-
-void GameBoardDominoes::AddLeftDomino(Domino2D& d)
-{
-    LeftSideDominoes.push_back(&d);
-}
-
-void GameBoardDominoes::AddRightDomino(Domino2D& d)
-{
-    RightSideDominoes.push_back(&d);
-}
-
-bool GameBoardDominoes::NoDominoesYet() const
-{
-    return FirstDomino == nullptr;
-}
-
-Domino2D* GameBoardDominoes::GetLatestLeftSideDomino()
-{
-    return LeftSideDominoes.back();
-}
-
-Domino2D* GameBoardDominoes::GetLatestRightSideDomino()
-{
-    return RightSideDominoes.back();
-}
-
-Domino2D* GameBoardDominoes::GetFirstDomino()
-{
-    return FirstDomino;
-}
-
-bool GameBoardDominoes::EmptyLeftSideDominoes() const
-{
-    return LeftSideDominoes.empty();
-}
-
-bool GameBoardDominoes::EmptyRightSideDominoes() const
-{
-    return RightSideDominoes.empty();
-}
-
-void GameBoardDominoes::RenderBoardDominoes()
-{
-    static const char* LeftDominoLabel[] = { "a##ls", "b##ls", "c##ls", "d##ls", "e##ls", "f##ls",
-                                              "g##ls", "h##ls", "i##ls", "j##ls", "k##ls", "l##ls",
-                                              "m##ls", "n##ls", "o##ls", "p##ls", "q##ls", "r##ls", "s##ls", "t##ls" };
-    static const char* RightDominoLabel[] = { "a##rs", "b##rs", "c##rs", "d##rs", "e##rs", "f##rs",
-                                              "g##rs", "h##rs", "i##rs", "j##rs", "k##rs", "l##rs",
-                                              "m##rs", "n##rs", "o##rs", "p##rs", "q##rs", "r##rs", "s##rs", "t##rs" };
-
-    // Render the first domino. The center most domino
-    FirstDomino->RenderTile("First Domino", false);
-
-    // Render the left side dominoes
-    for (int i = 0; auto & DT : LeftSideDominoes) {
-        ImGui::SameLine();
-        DT->RenderTile(LeftDominoLabel[i], i > 6);
-        i++;
-    }
-
-    // Render the right side dominoes
-    for (int i = 0; auto & DT : RightSideDominoes) {
-        ImGui::SameLine();
-        DT->RenderTile(RightDominoLabel[i], i > 6);
-        i++;
-    }
-}
-
-void GameBoardDominoes::ClearBoardDominoes()
-{
-    FirstDomino = nullptr;
-    LeftSideDominoes.clear();
-    RightSideDominoes.clear();
-}
-
-size_t GameBoardDominoes::LeftSideSize() const
-{
-    return LeftSideDominoes.size();
-}
-
-size_t GameBoardDominoes::RightSideSize() const
-{
-    return RightSideDominoes.size();
-}
-
-
-
-//-----------------------------------------------------------------------------------------------------------------------
-// DominoAI CLASS
-//-----------------------------------------------------------------------------------------------------------------------
-
-DominoAI::DominoAI(Player* p_data, Player* ai_data, uint16_t ai_difficulty)
-{
-    this->SetAIData(p_data, ai_data);
-    this->SetDifficulty(ai_difficulty);
-}
-
-void DominoAI::SetAIData(Player* p_data, Player* ai_data)
-{
-    this->AIData = ai_data;
-    this->PlayerData = p_data;
-}
-
-void DominoAI::SetDifficulty(uint16_t ai_difficulty)
-{
-    this->AIDifficulty = ai_difficulty;
-}
-
-void DominoAI::AIAttack()
-{
-    if (this->FirstTurnAIAttack()) {
-        return;
-    }
-
-    switch (this->AIDifficulty)
-    {
-    case AIDifficulty_Random:    this->RandomCompute();    return;
-    case AIDifficulty_Normal:    this->NormalCompute();    return;
-    case AIDifficulty_Hard:      this->HardCompute();      return;
-    case AIDifficulty_GigaBrain: this->GigaBrainCompute(); return;
-    default: return;
-    }
-}
-
-bool DominoAI::FirstTurnAIAttack()
-{
-    if (!dvars::GameState.IsThereAChangeInPlayer() || dvars::GameState.GetNumberOfTurns() != 0) {
-        return false;
-    }
-
-    auto& dgs = dvars::GameState;
-    auto& ai_cards = this->AIData->GetPlayerCards();
-    for (auto& ai_card : ai_cards) {
-        if (*ai_card != dgs.GetFirstTurnTile()) {
-            continue;
-        }
-
-        ai_card->SetAsFirstDomino();
-        dgs.AddBoardDominoes(*ai_card, TileDropPosition_Left);
-        break;
-    }
-
-    return true;
-}
-
-void DominoAI::RandomCompute()
-{
-    auto& dgs = dvars::GameState;
-    auto& ai_cards = AIData->GetPlayerCards();
-    const auto& seed = std::chrono::steady_clock::now().time_since_epoch().count();
-    std::mt19937_64 rng(seed);
-    std::shuffle(ai_cards.begin(), ai_cards.end(), rng);
-
-    for (auto ai_card : ai_cards) {
-        if (ai_card->IsRemoved()) {
-            continue;
-        }
-        if (dgs.NoDominoesYet()) {
-            ai_card->SetAsFirstDomino();
-            dgs.AddBoardDominoes(*ai_card, TileDropPosition_Left);
-            return;
-        }
-        if (ai_card->ConnectDomino(dgs.EmptyRightSideDominoes() ? *dgs.GetFirstDomino() : *dgs.GetLatestRightSideDomino(), TileDropPosition_Right)) {
-            dgs.AddBoardDominoes(*ai_card, TileDropPosition_Right);
-            return;
-        }
-        // Will use the first usable card and will attack on the left side
-        if (ai_card->ConnectDomino(dgs.EmptyLeftSideDominoes() ? *dgs.GetFirstDomino() : *dgs.GetLatestLeftSideDomino(), TileDropPosition_Left)) {
-            dgs.AddBoardDominoes(*ai_card, TileDropPosition_Left);
-            return;
-        }
-        // And if not possible, then on the right
-        // Otherwise, continue with loop and repeat
-    }
-}
-
-void DominoAI::NormalCompute()
-{
-
-}
-
-void DominoAI::HardCompute()
-{
-
-}
-
-void DominoAI::GigaBrainCompute()
-{
-
-}
-
-
-
-//-----------------------------------------------------------------------------------------------------------------------
-// DominoLogs CLASS
-//-----------------------------------------------------------------------------------------------------------------------
-
-void DominoLogs::AddLog(const Domino2D* d, uint16_t player_number, LogMove player_move)
-{
-    LogData.push_back(AttackLog(d, player_number, player_move));
-}
-
-void DominoLogs::ClearLog()
-{
-    LogData.clear();
-}
-
-void DominoLogs::RenderLog(int NumberOfTurn)
-{
-    if (NumberOfTurn == -1) {
-        // Render all logs
-        static const auto domino_sz = ImVec2(121.0f, 60.0f);
-        std::string DominoLabels = "DT##0";
-
-        for (size_t i = 0; auto & logs : LogData) {
-            logs.PlayerMove == LogMove_TurnAttack ? ImGui::Text("Turn %d: Player %d attacked with:", i, logs.PlayerNumber) : ImGui::Text("Turn %d: Player %d passed", i, logs.PlayerNumber);
-            if (logs.DominoUsed != nullptr) {
-                const auto& domino_pos = ImGui::GetCurrentWindow()->DC.CursorPos;
-                logs.DominoUsed->RenderTileIndependently(DominoLabels.c_str(), domino_sz, domino_pos);
-            }
-
-            i++;
-            ImGui::Separator();
-        }
-        return;
-    }
-
-    ImGui::BeginGroup(); {
-        constexpr ImVec2 LogDominoSize = ImVec2(141.0f, 70.0f);
-        const auto& CurrentLog = LogData[NumberOfTurn];
-        if (CurrentLog.DominoUsed == nullptr) {
-            ImGui::Text("Player %d passed!", CurrentLog.PlayerNumber);
-            ImGui::EndGroup();
-            return;
-        }
-
-        ImGui::Text("Player %d attacked with:", CurrentLog.PlayerNumber);
-        ImGuiWindow* window = ImGui::GetCurrentWindow();
-        const ImVec2& pos = window->DC.CursorPos;
-        ImGui::BeginDisabled(); {
-            CurrentLog.DominoUsed->RenderTileIndependently("Current Log", LogDominoSize, pos);
-        } ImGui::EndDisabled();
-    } ImGui::EndGroup();
-}
-
-
-
-//-----------------------------------------------------------------------------------------------------------------------
-// DominoGameStructure CLASS
-//-----------------------------------------------------------------------------------------------------------------------
-static void ResetGameDominoes()
-{
-    for (auto& GD : dvars::GameDominoes) {
-        GD.ResetParameters();
-    }
-}
-
-static void ShuffleGameDominoes()
-{
-    ResetGameDominoes();
-    auto seed = std::chrono::steady_clock::now().time_since_epoch().count();
-    std::mt19937 rng(seed);
-    std::shuffle(dvars::GameDominoes.begin(), dvars::GameDominoes.end(), rng);
-}
-
-DominoGameStructure::DominoGameStructure() :
-    Players({
-            PlayerDomino2D(0),
-            PlayerDomino2D(1),
-            PlayerDomino2D(2),
-            PlayerDomino2D(3),
-            PlayerDomino2D(4),
-            PlayerDomino2D(5),
-            PlayerDomino2D(6),
-            PlayerDomino2D(7)
-        }),
-    NumberOfPlayers(0),
-    NumberOfTurns(0)
-{}
-
-bool DominoGameStructure::InitializeGame(const uint16_t & number_of_players, const uint16_t& ai_difficulty, const bool& change_player)
-{
-    // Check if the number of players is eligible for the game
-    if (number_of_players < 4 || number_of_players > 8) {
-        GameInitialized = false;
-        return false;
-    }
-
-    // Set the AI difficulty
-    this->AIPlayerLogic.SetDifficulty(ai_difficulty);
-
-    // In domino, whenever there is a change in player (a player leaves, a player joins, a player leaves but another joins at the same time), the first player will change
-    ChangeInPlayers = NumberOfPlayers != number_of_players || change_player;
-    NumberOfPlayers = number_of_players;
-    NumberOfCards   = number_of_players == 4 ? 5 : (number_of_players > 6 ? 3 : 4);
-
-    this->DistributeCards();
-
-    if (PlayerOneAlwaysFirst) {
-        CurrentTurn = 0;
-        ChangeInPlayers = false;
-    }
-    else {
-        if (ChangeInPlayers) 
-            this->FindFirstPlayerTurn();
-        else                 
-            CurrentTurn = PlayerWinner;
-    }
-
-    GameInitialized = true;
-    return true;
-}
-
-void DominoGameStructure::SetPlayerOneAsFirstTurn(bool enable)
-{
-    this->PlayerOneAlwaysFirst = enable;
-}
-
-bool DominoGameStructure::CheckGameState()
-{
-    // Check if the current player already won
-    if (Players[CurrentTurn].NumberOfCards() == 0) {
-        PlayerWinner = CurrentTurn;
-        return true;
-    }
-
-    if (NumberOfPasses == NumberOfPlayers + 1) {
-        FindTheLowestSum();
-        return true;
-    }
-
-    return false;
-}
-
-bool DominoGameStructure::IsThereAChangeInPlayer()
-{
-    return ChangeInPlayers;
-}
-
-DominoTile DominoGameStructure::GetFirstTurnTile() const
-{
-    return FirstTurnTileAttack;
-}
-
-void DominoGameStructure::PassCurrentTurn()
-{
-    this->AddGameLogs(nullptr, CurrentTurn + 1, LogMove_TurnPassed);
-    TurnAdvance();
-    NumberOfPasses++;
-}
-
-PlayerDomino2D& DominoGameStructure::GetPlayerData(uint16_t pnum)
-{
-    return Players[pnum];
-}
-
-uint16_t DominoGameStructure::GetCurrentTurn() const
-{
-    return CurrentTurn;
-}
-
-void DominoGameStructure::SetNoClickedCard()
-{
-    Players[0].SetClickedCard(nullptr);
-}
-
-void DominoGameStructure::DistributeCards()
-{
-    int end_domino = 0;
-    ShuffleGameDominoes();
-
-    for (int p_idx = 0; p_idx < NumberOfPlayers; p_idx++) {
-        auto& CurrentPlayer = Players[p_idx]; // Reference for the current player for readability
-        CurrentPlayer.ClearCards();
-
-        int starting_domino = end_domino;		// Create the starting domino index and the end domino index for distribution
-        end_domino += NumberOfCards;
-
-        for (int current_domino = starting_domino; current_domino < end_domino; current_domino++) {
-            CurrentPlayer.SetCard(dvars::GameDominoes[current_domino]);
-        }
-        CurrentPlayer.InitializePlayerDomino();
-    }
-}
-
-void DominoGameStructure::FindFirstPlayerTurn()
-{
-    // Finding the player that has the double number starting from 6 to 1
-    for (int i = 6; i > 0; i--) {
-        for (int p = 0; p < NumberOfPlayers; p++) {
-            if (Players[p].HasTheDouble(i)) {
-                CurrentTurn = FirstTurn = p;
-                FirstTurnTileAttack = DominoTile(i, i);
-                return;
-            }
-        }
-    }
-
-    // If there is no one who has the double number, find the player who has the highest card 
-    for (int i = 6; i > 0; i--) {
-        for (int j = i - 1; i >= 0; j--) {
-            for (int p = 0; p < NumberOfPlayers; p++) {
-                if (Players[p].HasTheHighestCard(i, j)) {
-                    CurrentTurn = FirstTurn = p;
-                    FirstTurnTileAttack = DominoTile(i, j);
-                    return;
-                }
-            }
-        }
-    }
-}
-
-void DominoGameStructure::FindTheLowestSum()
-{
-    uint16_t lowest_sum = 100;
-    uint16_t current_winner = 10;
-    uint16_t current_sum;
-
-    for (int i = 0; i < NumberOfPlayers; i++) {
-        current_sum = Players[i].SumOfCards();
-
-        if (current_sum < lowest_sum) {
-            lowest_sum = current_sum;
-            current_winner = i;
-        }
-        else if (current_sum == lowest_sum) [[unlikely]] {
-            current_winner = Players[i].NumberOfCards() < Players[current_winner].NumberOfCards() ? i : (i > FirstTurn && current_winner > FirstTurn) ? current_winner : i;
-        }
-    }
-
-    PlayerWinner = current_winner;
-}
-
-Domino2D* DominoGameStructure::GetPlayerSelectedCard(uint16_t player_number)
-{
-    return Players[player_number].GetClickedCard();
-}
-
-bool DominoGameStructure::RenderPlayerDominoes()
-{
-    return Players[0].RenderPlayerDominoes();
-}
-
-void DominoGameStructure::ClearPlayerDominoes()
-{
-    for (auto& P : Players) {
-        P.ClearDominoes();
-    }
-}
-
-void DominoGameStructure::TurnAdvance()
-{
-    NumberOfTurns++;
-    CurrentTurn++;
-    if (CurrentTurn == NumberOfPlayers){
-        CurrentTurn = 0;
-    }
-}
-
-bool DominoGameStructure::CurrentPlayerCanAttack()
-{
-    const auto& P = Players[CurrentTurn].GetPlayerCards();
-
-    for (auto PC : P) {
-        if (!PC->IsRemoved()) {
-            if (PC->PseudoConnectDomino(EmptyLeftSideDominoes() ? *GetFirstDomino() : *GetLatestLeftSideDomino())) {
-                return true;
-            }
-            if (PC->PseudoConnectDomino(EmptyRightSideDominoes() ? *GetFirstDomino() : *GetLatestRightSideDomino())) {
-                return true;
-            }
-        }
-    }
-
-    return false;
-}
-
-void DominoGameStructure::AddBoardDominoes(Domino2D& D, int left_or_right)
-{
-    // If it's empty, then it's the first turn of the game, then set the domino for first domino placement
-    if (NoDominoesYet()) {
-        D.SetAsFirstDomino();
-        AddFirstDomino(D);
-    }
-    else if (left_or_right == TileDropPosition_Left) {
-        AddLeftDomino(D);
-    }
-    else if (left_or_right == TileDropPosition_Right) {
-        AddRightDomino(D);
-    }
-
-    // Log the current move
-    this->AddGameLogs(&D, CurrentTurn + 1, LogMove_TurnAttack);
-    // Because there is an added domino on board, then the number of passes shall reset
-    NumberOfPasses = 0;
-}
-
-uint16_t DominoGameStructure::GetWinnerNumber() const
-{
-    return PlayerWinner + 1;
-}
-
-void DominoGameStructure::ResetGameState()
-{
-    // Clear the board dominoes
-    this->ClearBoardDominoes();
-    // Clear the players' dominoes
-    this->ClearPlayerDominoes();
-    // Clear game logs
-    this->ClearGameLogs();
-    // Reset dominoes states
-    ResetGameDominoes();
-    NumberOfTurns  = 0;
-    NumberOfCards  = 0;
-    NumberOfPasses = 0;
-}
-
-uint16_t DominoGameStructure::GetNumberOfPlayers() const
-{
-    return NumberOfPlayers;
-}
-
-bool DominoGameStructure::AIAttackFunc()
-{
-    if (!NoDominoesYet() && !this->CurrentPlayerCanAttack()) {
-        return false;
-    }
-
-    const auto& ai_num = CurrentTurn;
-    AIPlayerLogic.SetAIData(&this->GetPlayerData(0), &this->GetPlayerData(ai_num));
-    AIPlayerLogic.AIAttack();
-    return true;
-}
-
-void DominoGameStructure::AddGameLogs(const Domino2D* d, uint16_t player_number, LogMove player_move)
-{
-    GameLog.AddLog(d, player_number, player_move);
-}
-
-void DominoGameStructure::ClearGameLogs()
-{
-    GameLog.ClearLog();
-}
-
-void DominoGameStructure::RenderGameLogs()
-{
-    GameLog.RenderLog(-1);
-}
-
-void DominoGameStructure::RenderCurrentTurnLog()
-{
-    if (NumberOfTurns == 0) {
-        ImGui::Text("NO MOVES YET");
-        return;
-    }
-
-    GameLog.RenderLog(NumberOfTurns - 1);
-}
-
-uint16_t DominoGameStructure::GetNumberOfTurns() const
-{
-    return NumberOfTurns;
-}
-
-
-
-
-
-
-
+#include "GameLogic.h"
+#include "imgui_internal.h"
+
+//-----------------------------------------------------------------------------------------------------------------------
+// DominoTile CLASS
+//-----------------------------------------------------------------------------------------------------------------------
+
+constexpr DominoTile::DominoTile(uint16_t num1, uint16_t num2) :
+	removed(false),
+	left_number(num1),
+	right_number(num2)
+{}
+
+constexpr uint16_t DominoTile::TileSum()
+{
+	return left_number + right_number;
+}
+
+constexpr bool DominoTile::IsDoubleNumber() const
+{
+	return left_number == right_number;
+}
+
+constexpr bool DominoTile::IsRemoved() const
+{
+	return removed;
+}
+
+constexpr uint16_t DominoTile::GetLeftNumber() const
+{
+	return left_number;
+}
+
+constexpr uint16_t DominoTile::GetRightNumber() const
+{
+	return right_number;
+}
+
+void DominoTile::ChangeCardRemoveState(bool r)
+{
+    this->removed = r;
+}
+
+
+
+//-----------------------------------------------------------------------------------------------------------------------
+// Player CLASS
+//-----------------------------------------------------------------------------------------------------------------------
+
+Player::Player(const uint16_t& p_num)
+{
+    PlayerNumber = p_num;
+}
+
+uint16_t Player::GetPlayerNum() const
+{
+    return PlayerNumber;
+}
+
+std::vector<Domino2D*>& Player::GetPlayerCards()
+{
+    return PlayerCards;
+}
+
+uint16_t Player::SumOfCards() const
+{
+    uint16_t sum = 0;
+
+    for (auto Card : PlayerCards) {
+        if (!Card->IsRemoved()) {
+            sum += (Card->GetLeftNumber() + Card->GetRightNumber());
+        }
+    }
+
+    return sum;
+}
+
+uint16_t Player::NumberOfCards() const
+{
+    uint16_t numcard = 0;
+
+    for (auto* Card : PlayerCards) {
+        if (!Card->IsRemoved()) {
+            numcard++;
+        }
+    }
+
+    return numcard;
+}
+
+void Player::SetClickedCard(Domino2D* dcard)
+{
+    CurrentlyClickedCard = dcard;
+}
+
+Domino2D* Player::GetClickedCard()
+{
+    return CurrentlyClickedCard;
+}
+
+void Player::ClearCards()
+{
+    PlayerCards.clear();
+}
+
+void Player::SetPlayerNum(uint16_t p_num)
+{
+    PlayerNumber = p_num;
+}
+
+void Player::SetCard(Domino2D& card)
+{
+    PlayerCards.push_back(&card);
+}
+
+uint16_t Player::GetRemainingCards()
+{
+    uint16_t remaining_cards = 0;
+
+    for (auto& C : PlayerCards) {
+        if (!C->IsRemoved()) {
+            remaining_cards++;
+        }
+    }
+
+    return remaining_cards;
+}
+
+
+
+//-----------------------------------------------------------------------------------------------------------------------
+// Domino2D CLASS
+//-----------------------------------------------------------------------------------------------------------------------
+
+// Functions for drawing the dots of the dominoes
+namespace domino_dots
+{
+    struct DotLayout
+    {
+        float  Radius;
+        int    Count;
+        ImVec2 Dots[12];
+    };
+
+    // Dot positions of the numbers 0 to 12 on a horizontal tile side, in the 21 x 21 units of the side. Up to 9 dots
+    // are placed on a 3 x 3 grid, 10 to 12 dots on a 4 x 3 grid with smaller dots
+    static const DotLayout DotLayouts[13] = {
+        { 2.5f, 0,  {} },
+        { 2.5f, 1,  { {10.5f, 10.5f} } },
+        { 2.5f, 2,  { {17.0f, 4.0f}, {4.0f, 17.0f} } },
+        { 2.5f, 3,  { {17.0f, 4.0f}, {10.5f, 10.5f}, {4.0f, 17.0f} } },
+        { 2.5f, 4,  { {4.0f, 4.0f}, {17.0f, 17.0f}, {17.0f, 4.0f}, {4.0f, 17.0f} } },
+        { 2.5f, 5,  { {4.0f, 4.0f}, {17.0f, 17.0f}, {10.5f, 10.5f}, {17.0f, 4.0f}, {4.0f, 17.0f} } },
+        { 2.5f, 6,  { {4.0f, 4.0f}, {10.5f, 4.0f}, {17.0f, 17.0f}, {17.0f, 4.0f}, {10.5f, 17.0f}, {4.0f, 17.0f} } },
+        { 2.5f, 7,  { {4.0f, 4.0f}, {10.5f, 4.0f}, {17.0f, 4.0f}, {10.5f, 10.5f}, {4.0f, 17.0f}, {10.5f, 17.0f}, {17.0f, 17.0f} } },
+        { 2.5f, 8,  { {4.0f, 4.0f}, {10.5f, 4.0f}, {17.0f, 4.0f}, {4.0f, 10.5f}, {17.0f, 10.5f}, {4.0f, 17.0f}, {10.5f, 17.0f}, {17.0f, 17.0f} } },
+        { 2.5f, 9,  { {4.0f, 4.0f}, {10.5f, 4.0f}, {17.0f, 4.0f}, {4.0f, 10.5f}, {10.5f, 10.5f}, {17.0f, 10.5f}, {4.0f, 17.0f}, {10.5f, 17.0f}, {17.0f, 17.0f} } },
+        { 2.0f, 10, { {3.5f, 4.0f}, {8.2f, 4.0f}, {12.8f, 4.0f}, {17.5f, 4.0f}, {8.2f, 10.5f}, {12.8f, 10.5f},
+                      {3.5f, 17.0f}, {8.2f, 17.0f}, {12.8f, 17.0f}, {17.5f, 17.0f} } },
+        { 2.0f, 11, { {3.5f, 4.0f}, {8.2f, 4.0f}, {12.8f, 4.0f}, {17.5f, 4.0f}, {4.0f, 10.5f}, {10.5f, 10.5f}, {17.0f, 10.5f},
+                      {3.5f, 17.0f}, {8.2f, 17.0f}, {12.8f, 17.0f}, {17.5f, 17.0f} } },
+        { 2.0f, 12, { {3.5f, 4.0f}, {8.2f, 4.0f}, {12.8f, 4.0f}, {17.5f, 4.0f}, {3.5f, 10.5f}, {8.2f, 10.5f}, {12.8f, 10.5f}, {17.5f, 10.5f},
+                      {3.5f, 17.0f}, {8.2f, 17.0f}, {12.8f, 17.0f}, {17.5f, 17.0f} } }
+    };
+
+    // Draw the left side of the domino. Vertically, it's the upper side.
+    static void leftDotNumber(uint16_t number, const ImVec2& pos, float scale, ImU32 color, bool vertical = false)
+    {
+        if (number > 12) {
+            return;
+        }
+
+        ImDrawList*      draw_list = ImGui::GetWindowDrawList();
+        const DotLayout& layout    = DotLayouts[number];
+        for (int i = 0; i < layout.Count; i++) {
+            // The vertical side is the horizontal one turned a quarter
+            const ImVec2& dot    = layout.Dots[i];
+            const ImVec2  offset = vertical ? ImVec2(21.0f - dot.y, dot.x) : dot;
+            draw_list->AddCircleFilled(ImVec2(pos.x + (scale * offset.x), pos.y + (scale * offset.y)), scale * layout.Radius, color, 40);
+        }
+    }
+    // Draw the right side of the domino. Vertically, it's the lower side.
+    static void rightDotNumber(uint16_t number, float leftWidth, const ImVec2& pos, float scale, ImU32 col, bool vertical = false)
+    {
+        auto new_pos = vertical ? ImVec2(pos.x, pos.y + leftWidth) : ImVec2(pos.x + leftWidth, pos.y);
+        leftDotNumber(number, new_pos, scale, col, vertical);
+    }
+    // Draw the line between the left and right/up and down side.
+    static void middleLine(float leftWidth, const ImVec2& pos, float scale, ImU32 col, bool vertical = false)
+    {
+        ImDrawList* draw_list = ImGui::GetWindowDrawList();
+        if (vertical) {
+            draw_list->AddRectFilled(ImVec2((1.5f * scale) + pos.x, leftWidth - (scale * 0.55f) + pos.y), ImVec2(pos.x + (19.5f * scale), leftWidth + pos.y + (scale * 0.55f)), col, 0.0f);
+        }
+        else {
+            draw_list->AddRectFilled(ImVec2(leftWidth - (scale * 0.55f) + pos.x, pos.y + (1.5f * scale)), ImVec2(leftWidth + pos.x + (scale * 0.55f), pos.y + (19.5f * scale)), col, 0.0f);
+        }
+    }
+}
+
+Domino2D::Domino2D(uint16_t leftnumber, uint16_t rightnumber)
+{
+    CreateTile(leftnumber, rightnumber);
+}
+
+//---------------------------
+// STATIC FUNCTIONS
+//---------------------------
+
+void Domino2D::InitiateDominoStatics(float tile_h, ImU32 tile_col, ImU32 dot_col)
+{
+    TileHeight = tile_h;
+    TileWidth = (TileHeight * 2) + 1;
+    TileScale = TileHeight / 21.0f;
+    TileLeftWidth = TileHeight + 1;
+    TileVecSize = ImVec2(TileWidth, TileHeight);
+    TileColor = tile_col;
+    DotColor = dot_col;
+}
+
+void Domino2D::InitiateDominoStatics(float tile_h, const ImVec4& tile_col, const ImVec4& dot_col)
+{
+    InitiateDominoStatics(tile_h, ImGui::ColorConvertFloat4ToU32(tile_col), ImGui::ColorConvertFloat4ToU32(dot_col));
+}
+
+void Domino2D::ChangeColors(ImU32 tile_col, ImU32 dot_col)
+{
+    TileColor = tile_col;
+    DotColor = dot_col;
+}
+
+void Domino2D::ChangeColors(const ImVec4& tile_col, const ImVec4& dot_col)
+{
+    TileColor = ImGui::ColorConvertFloat4ToU32(tile_col);
+    DotColor = ImGui::ColorConvertFloat4ToU32(dot_col);
+}
+
+void Domino2D::ChangeSize(float tile_h)
+{
+    TileHeight = tile_h;
+    TileWidth = (TileHeight * 2) + 1;
+    TileScale = TileHeight / 21.0f;
+    TileLeftWidth = TileHeight + 1;
+    TileVecSize = ImVec2(TileWidth, TileHeight);
+}
+
+ImU32& Domino2D::GetTileColor()
+{
+    return TileColor;
+}
+
+ImU32& Domino2D::GetDotColor()
+{
+    return DotColor;
+}
+
+ImVec2& Domino2D::GetDimensions()
+{
+    return TileVecSize;
+}
+
+//---------------------------
+// NON-STATIC FUNCTIONS
+//---------------------------
+
+void Domino2D::CreateTile(uint16_t leftnumber, uint16_t rightnumber)
+{
+    MirrorTile        = false;
+    removed           = false;
+    left_number       = leftnumber;
+    right_number      = rightnumber;
+    left_connectable  = true;
+    right_connectable = true;
+    TileOrientation   = TileOrientation_Horizontal;
+    TilePos           = ImVec2(0, 0);
+}
+
+ImVec2 Domino2D::GetPos() const
+{
+    return TilePos;
+}
+
+uint16_t Domino2D::GetTileNumber() const
+{
+    return (left_number * 10) + right_number;
+}
+
+uint16_t Domino2D::GetSideNumber(int pos) const
+{
+    if (pos == TileDropPosition_Left) {
+        return MirrorTile ? right_number : left_number;
+    }
+    return MirrorTile ? left_number : right_number;
+}
+
+bool Domino2D::SetAsFirstDomino()
+{
+    const ImVec2& window = ImGui::GetWindowContentRegionMax();
+    if (this->IsDoubleNumber()) {
+        TilePos = (window / 2.0f) - ImVec2(TileHeight / 2.0f, TileWidth / 2.0f) + ImVec2(0.0f, 20.0f);
+        TileOrientation = TileOrientation_Vertical;
+    }
+    else {
+        TilePos = (window / 2.0f) - ImVec2(TileWidth / 2.0f, TileHeight / 2.0f) + ImVec2(0.0f, 20.0f);
+        TileOrientation = TileOrientation_Horizontal;
+    }
+
+    removed = true;
+    return true;
+}
+
+void Domino2D::ChangeLeftNumConnection(bool connectable)
+{
+    this->left_connectable = connectable;
+}
+
+void Domino2D::ChangeRightNumConnection(bool connectable)
+{
+    this->right_connectable = connectable;
+}
+
+bool Domino2D::IsLeftConnectable() const
+{
+    return left_connectable;
+}
+
+bool Domino2D::IsRightConnectable() const
+{
+    return right_connectable;
+}
+
+void Domino2D::ResetParameters()
+{
+    TilePos           = ImVec2(0, 0);
+    MirrorTile        = false;
+    left_connectable  = true;
+    right_connectable = true;
+    removed           = false;
+    TileOrientation   = TileOrientation_Horizontal;
+}
+
+void Domino2D::ChangePosition(float plus_x, float plus_y)
+{
+    TilePos.x += plus_x;
+    TilePos.y += plus_y;
+}
+
+bool Domino2D::ConnectDominoOnLeft(Domino2D& DominoConnectee)
+{
+    const uint16_t& ConnecteeLeftNumber = DominoConnectee.MirrorTile ? DominoConnectee.GetRightNumber() : DominoConnectee.GetLeftNumber();
+
+    if (this->GetRightNumber() == ConnecteeLeftNumber) {
+        this->MirrorTile = false;
+        this->ChangeRightNumConnection(false);
+    }
+    else if (this->GetLeftNumber() == ConnecteeLeftNumber) {
+        this->MirrorTile = true;
+        this->ChangeLeftNumConnection(false);
+    }
+    else {
+        return false;
+    }
+
+    if (DominoConnectee.IsDoubleNumber()) {
+        if (dvars::GameState.LeftSideSize() == 5) {
+            DominoConnectee.TilePos.x = DominoConnectee.TilePos.x - TileHeight;
+            DominoConnectee.TilePos.y = DominoConnectee.TilePos.y + (TileWidth / 2.0f) - (TileHeight / 2.0f);
+            DominoConnectee.TileOrientation = TileOrientation_Horizontal;
+            TilePos.x = DominoConnectee.TilePos.x - TileHeight;
+            TilePos.y = DominoConnectee.TilePos.y - TileHeight;
+            TileOrientation = TileOrientation_Vertical;
+        }
+        else if (dvars::GameState.LeftSideSize() == 6) {
+            TilePos.x = DominoConnectee.TilePos.x;
+            TilePos.y = DominoConnectee.TilePos.y - TileWidth;
+            TileOrientation = TileOrientation_Vertical;
+        }
+        else if (dvars::GameState.LeftSideSize() == 7) {
+            TilePos.x = DominoConnectee.TilePos.x;
+            TilePos.y = DominoConnectee.TilePos.y - TileHeight;
+            TileOrientation = TileOrientation_Horizontal;
+        }
+        else if (dvars::GameState.LeftSideSize() == 8) {
+            TilePos.x = DominoConnectee.TilePos.x + TileWidth;
+            TilePos.y = DominoConnectee.TilePos.y;
+            TileOrientation = TileOrientation_Horizontal;
+        }
+        else if (DominoConnectee.TileOrientation == TileOrientation_Horizontal) {
+            TilePos.x = DominoConnectee.TilePos.x + (TileWidth / 2.0f) - (TileHeight / 2.0f);
+            TilePos.y = DominoConnectee.TilePos.y - TileWidth;
+            TileOrientation = TileOrientation_Vertical;
+        }
+        else {
+            if (dvars::GameState.LeftSideSize() > 8) {
+                TilePos.x = DominoConnectee.TilePos.x + TileHeight;
+                TilePos.y = DominoConnectee.TilePos.y + (TileWidth / 2.0f) - (TileHeight / 2.0f);
+            }
+            else {
+                TilePos.x = DominoConnectee.TilePos.x - TileWidth;
+                TilePos.y = DominoConnectee.TilePos.y + (TileWidth / 2.0f) - (TileHeight / 2.0f);
+            }
+            TileOrientation = TileOrientation_Horizontal;
+        }
+    }
+    else if (this->IsDoubleNumber()) {
+        if (dvars::GameState.LeftSideSize() == 5) {
+            TilePos.x = DominoConnectee.TilePos.x - TileHeight;
+            TilePos.y = DominoConnectee.TilePos.y - (TileWidth / 2.0f);
+            TileOrientation = TileOrientation_Vertical;
+        }
+        else if (dvars::GameState.LeftSideSize() == 6) {
+            TilePos.x = DominoConnectee.TilePos.x;
+            TilePos.y = DominoConnectee.TilePos.y - TileWidth;
+            TileOrientation = TileOrientation_Vertical;
+        }
+        else if (dvars::GameState.LeftSideSize() == 7) {
+            TilePos.x = DominoConnectee.TilePos.x;
+            TilePos.y = DominoConnectee.TilePos.y - TileHeight;
+            TileOrientation = TileOrientation_Horizontal;
+        }
+        else if (DominoConnectee.TileOrientation == TileOrientation_Horizontal) {
+            if (dvars::GameState.LeftSideSize() > 7) {
+                TilePos.x = DominoConnectee.TilePos.x + TileWidth;
+                TilePos.y = DominoConnectee.TilePos.y - (TileWidth / 2.0f) + (TileHeight / 2.0f);
+            }
+            else {
+                TilePos.x = DominoConnectee.TilePos.x - TileHeight;
+                TilePos.y = DominoConnectee.TilePos.y - (TileWidth / 2.0f) + (TileHeight / 2.0f);
+            }
+            TileOrientation = TileOrientation_Vertical;
+        }
+        else {
+            TilePos.x = DominoConnectee.TilePos.x - (TileWidth / 2.0f) + (TileHeight / 2.0f);
+            TilePos.y = DominoConnectee.TilePos.y - TileHeight;
+            TileOrientation = TileOrientation_Horizontal;
+        }
+    }
+    else {
+        if (dvars::GameState.LeftSideSize() == 5) {
+            TilePos.x = DominoConnectee.TilePos.x - TileHeight;
+            TilePos.y = DominoConnectee.TilePos.y - (TileWidth / 2.0f);
+            TileOrientation = TileOrientation_Vertical;
+        }
+        else if (dvars::GameState.LeftSideSize() == 6) {
+            TilePos.x = DominoConnectee.TilePos.x;
+            TilePos.y = DominoConnectee.TilePos.y - TileWidth;
+            TileOrientation = TileOrientation_Vertical;
+        }
+        else if (dvars::GameState.LeftSideSize() == 7) {
+            TilePos.x = DominoConnectee.TilePos.x;
+            TilePos.y = DominoConnectee.TilePos.y - TileHeight;
+            TileOrientation = TileOrientation_Horizontal;
+        }
+        else if (DominoConnectee.TileOrientation == TileOrientation_Vertical) {
+            TilePos.x = DominoConnectee.TilePos.x;
+            TilePos.y = DominoConnectee.TilePos.y - TileWidth;
+            TileOrientation = TileOrientation_Vertical;
+        }
+        else {
+            if (dvars::GameState.LeftSideSize() > 7) {
+                TilePos.x = DominoConnectee.TilePos.x + TileWidth;
+                TilePos.y = DominoConnectee.TilePos.y;
+            }
+            else {
+                TilePos.x = DominoConnectee.TilePos.x - TileWidth;
+                TilePos.y = DominoConnectee.TilePos.y;
+            }
+            TileOrientation = TileOrientation_Horizontal;
+        }
+    }
+
+    this->removed = true;
+    DominoConnectee.MirrorTile ? DominoConnectee.ChangeRightNumConnection(false) : DominoConnectee.ChangeLeftNumConnection(false);
+    return true;
+}
+
+bool Domino2D::ConnectDominoOnRight(Domino2D& DominoConnectee)
+{
+    const uint16_t& RightNumber          = this->GetRightNumber();
+    const uint16_t& LeftNumber           = this->GetLeftNumber();
+    const uint16_t& ConnecteeRightNumber = DominoConnectee.MirrorTile ? DominoConnectee.GetLeftNumber() : DominoConnectee.GetRightNumber();
+
+    if (RightNumber == ConnecteeRightNumber) {
+        MirrorTile = true;
+        this->ChangeRightNumConnection(false);
+    }
+    else if (LeftNumber == ConnecteeRightNumber) {
+        MirrorTile = false;
+        this->ChangeLeftNumConnection(false);
+    }
+    else {
+        return false;
+    }
+
+    if (DominoConnectee.IsDoubleNumber()) {
+        if (dvars::GameState.RightSideSize() == 5) {
+            DominoConnectee.TilePos.x = DominoConnectee.TilePos.x;
+            DominoConnectee.TilePos.y = DominoConnectee.TilePos.y + (TileWidth / 2.0f) - (TileHeight / 2.0f);
+            DominoConnectee.TileOrientation = TileOrientation_Horizontal;
+            TilePos.x = DominoConnectee.TilePos.x + TileWidth;
+            TilePos.y = DominoConnectee.TilePos.y;
+            TileOrientation = TileOrientation_Vertical;
+        }
+        else if (dvars::GameState.RightSideSize() == 6) {
+            TilePos.x = DominoConnectee.TilePos.x;
+            TilePos.y = DominoConnectee.TilePos.y + TileWidth;
+            TileOrientation = TileOrientation_Vertical;
+        }
+        else if (dvars::GameState.RightSideSize() == 7) {
+            TilePos.x = DominoConnectee.TilePos.x - (TileWidth / 2.0f);
+            TilePos.y = DominoConnectee.TilePos.y + TileWidth;
+            TileOrientation = TileOrientation_Horizontal;
+        }
+        else if (dvars::GameState.RightSideSize() == 8) {
+            TilePos.x = DominoConnectee.TilePos.x - TileWidth;
+            TilePos.y = DominoConnectee.TilePos.y;
+            TileOrientation = TileOrientation_Horizontal;
+        }
+        else if (DominoConnectee.TileOrientation == TileOrientation_Horizontal) {
+            TilePos.x = DominoConnectee.TilePos.x + (TileWidth / 2.0f) - (TileHeight / 2.0f);
+            TilePos.y = DominoConnectee.TilePos.y + TileHeight;
+            TileOrientation = TileOrientation_Vertical;
+        }
+        else {
+            if (dvars::GameState.LeftSideSize() > 8) {
+                TilePos.x = DominoConnectee.TilePos.x - TileWidth;
+                TilePos.y = DominoConnectee.TilePos.y + (TileWidth / 2.0f) - (TileHeight / 2.0f);
+            }
+            else {
+                TilePos.x = DominoConnectee.TilePos.x + TileHeight;
+                TilePos.y = DominoConnectee.TilePos.y + (TileWidth / 2.0f) - (TileHeight / 2.0f);
+            }
+            TileOrientation = TileOrientation_Horizontal;
+        }
+    }
+    else if (this->IsDoubleNumber()) {
+        if (dvars::GameState.RightSideSize() == 5) {
+            TilePos.x = DominoConnectee.TilePos.x + TileWidth;
+            TilePos.y = DominoConnectee.TilePos.y;
+            TileOrientation = TileOrientation_Vertical;
+        }
+        else if (dvars::GameState.RightSideSize() == 6) {
+            TilePos.x = DominoConnectee.TilePos.x;
+            TilePos.y = DominoConnectee.TilePos.y + TileWidth;
+            TileOrientation = TileOrientation_Vertical;
+        }
+        else if (dvars::GameState.RightSideSize() == 7) {
+            TilePos.x = DominoConnectee.TilePos.x - (TileWidth / 2.0f);
+            TilePos.y = DominoConnectee.TilePos.y + TileWidth;
+            TileOrientation = TileOrientation_Horizontal;
+        }
+        else if (DominoConnectee.TileOrientation == TileOrientation_Horizontal) {
+            if (dvars::GameState.RightSideSize() > 7) {
+                TilePos.x = DominoConnectee.TilePos.x - TileHeight;
+                TilePos.y = DominoConnectee.TilePos.y - (TileWidth / 2.0f) + (TileHeight / 2.0f);
+            }
+            else {
+                TilePos.x = DominoConnectee.TilePos.x + TileWidth;
+                TilePos.y = DominoConnectee.TilePos.y - (TileWidth / 2.0f) + (TileHeight / 2.0f);
+            }
+            TileOrientation = TileOrientation_Vertical;
+        }
+        else {
+            TilePos.x = DominoConnectee.TilePos.x - (TileWidth / 2.0f) + (TileHeight / 2.0f);
+            TilePos.y = DominoConnectee.TilePos.y + TileWidth;
+            TileOrientation = TileOrientation_Horizontal;
+        }
+    }
+    else {
+        if (dvars::GameState.RightSideSize() == 5) {
+            TilePos.x = DominoConnectee.TilePos.x + TileWidth;
+            TilePos.y = DominoConnectee.TilePos.y;
+            TileOrientation = TileOrientation_Vertical;
+        }
+        else if (dvars::GameState.RightSideSize() == 6) {
+            TilePos.x = DominoConnectee.TilePos.x;
+            TilePos.y = DominoConnectee.TilePos.y + TileWidth;
+            TileOrientation = TileOrientation_Vertical;
+        }
+        else if (dvars::GameState.RightSideSize() == 7) {
+            TilePos.x = DominoConnectee.TilePos.x - (TileWidth / 2.0f);
+            TilePos.y = DominoConnectee.TilePos.y + TileWidth;
+            TileOrientation = TileOrientation_Horizontal;
+        }
+        else if (DominoConnectee.TileOrientation == TileOrientation_Vertical) {
+            TilePos.x = DominoConnectee.TilePos.x;
+            TilePos.y = DominoConnectee.TilePos.y + TileWidth;
+        }
+        else {
+            if (dvars::GameState.RightSideSize() > 7) {
+                TilePos.x = DominoConnectee.TilePos.x - TileWidth;
+                TilePos.y = DominoConnectee.TilePos.y;
+            }
+            else {
+                TilePos.x = DominoConnectee.TilePos.x + TileWidth;
+                TilePos.y = DominoConnectee.TilePos.y;
+            }
+            TileOrientation = TileOrientation_Horizontal;
+        }
+    }
+    // Changes the current tile status to removed and the connectee's corresponding tile unconnectable
+    this->removed = true;
+    DominoConnectee.MirrorTile ? DominoConnectee.ChangeLeftNumConnection(false) : DominoConnectee.ChangeRightNumConnection(false);
+    return true;
+}
+
+bool Domino2D::ConnectDomino(Domino2D& DominoConnectee, int drop_pos)
+{
+    const auto& connectable = drop_pos == TileDropPosition_Left ?  (!DominoConnectee.MirrorTile ? DominoConnectee.IsLeftConnectable() : DominoConnectee.IsRightConnectable()) :
+                                                                   (DominoConnectee.MirrorTile ? DominoConnectee.IsLeftConnectable() : DominoConnectee.IsRightConnectable());
+    if (!connectable) {
+        return false;
+    }
+
+    if (drop_pos == TileDropPosition_Left) {
+        return ConnectDominoOnLeft(DominoConnectee);
+    }
+
+    if (drop_pos >= TileDropPosition_Right) {
+        return ConnectDominoOnRight(DominoConnectee);
+    }
+
+    return false;
+}
+
+bool Domino2D::PseudoConnectDomino(Domino2D& DominoConnectee) const
+{
+    if (!DominoConnectee.IsLeftConnectable() && !DominoConnectee.IsRightConnectable()) {
+        return false;
+    }
+
+    const bool& leftconnect = DominoConnectee.MirrorTile ? DominoConnectee.IsRightConnectable() : DominoConnectee.IsLeftConnectable();
+    const bool& rightconnect = DominoConnectee.MirrorTile ? DominoConnectee.IsLeftConnectable() : DominoConnectee.IsRightConnectable();
+    const uint16_t& RightNumber = this->GetRightNumber();
+    const uint16_t& LeftNumber  = this->GetLeftNumber();
+    const uint16_t& ConnecteeLeftNumber  = DominoConnectee.MirrorTile ? DominoConnectee.GetRightNumber() : DominoConnectee.GetLeftNumber();
+    const uint16_t& ConnecteeRightNumber = DominoConnectee.MirrorTile ? DominoConnectee.GetLeftNumber()  : DominoConnectee.GetRightNumber();
+
+    //if (DominoConnectee.TileNumbers.IsDoubleNumber()) [[unlikely]] {
+    //    connect1 = RightNumber == ConnecteeLeftNumber || LeftNumber == ConnecteeRightNumber;
+    //}
+
+    bool connect1 = (RightNumber == ConnecteeLeftNumber  && leftconnect)  || (LeftNumber == ConnecteeRightNumber && rightconnect);
+    bool connect2 = (RightNumber == ConnecteeRightNumber && rightconnect) || (LeftNumber == ConnecteeLeftNumber  && leftconnect);
+
+    return connect1 || connect2;
+}
+
+bool Domino2D::TileButton(const char* label, bool OverrideMirror, ImGuiButtonFlags flags) const
+{
+    using namespace ImGui;
+    ImGuiWindow* window = GetCurrentWindow();
+    if (window->SkipItems)
+        return false;
+
+    ImGuiContext& g = *GImGui;
+    const ImGuiStyle& style = g.Style;
+    const ImGuiID id = window->GetID(label);
+    const ImVec2 label_size = CalcTextSize(label, NULL, true);
+    const bool Mirror = OverrideMirror ? !MirrorTile : MirrorTile;
+
+    ImVec2 pos = TilePos;
+    ImVec2 size = CalcItemSize(TileOrientation == TileOrientation_Vertical ? ImVec2(TileVecSize.y, TileVecSize.x) : TileVecSize, label_size.x + style.FramePadding.x * 2.0f, label_size.y + style.FramePadding.y * 2.0f);
+
+    const ImRect bb(pos, pos + size);
+    ItemSize(size, style.FramePadding.y);
+    if (!ItemAdd(bb, id))
+        return false;
+
+    if (g.LastItemData.InFlags & ImGuiItemFlags_ButtonRepeat)
+        flags |= ImGuiButtonFlags_Repeat;
+
+    bool hovered, held;
+    bool pressed = ButtonBehavior(bb, id, &hovered, &held, flags);
+
+    // Render
+    //const ImU32 col = held && hovered ? GetColorU32(ImGuiCol_ButtonActive) : (hovered ? GetColorU32(ImGuiCol_ButtonHovered) : TileColor);
+    const ImU32 col = GetColorU32((held && hovered) ? ImGuiCol_ButtonActive : hovered ? ImGuiCol_ButtonHovered : ImGuiCol_Button);
+
+    RenderNavHighlight(bb, id);
+    RenderFrame(bb.Min, bb.Max, col, true, 3.0f * TileScale);
+
+    if (g.LogEnabled)
+        LogSetNextTextDecoration("[", "]");
+
+    domino_dots::leftDotNumber(Mirror ? right_number : left_number, pos, TileScale, DotColor, TileOrientation);
+    domino_dots::middleLine(TileLeftWidth, pos, TileScale, DotColor, TileOrientation);
+    domino_dots::rightDotNumber(Mirror ? left_number : right_number, TileLeftWidth, pos, TileScale, DotColor, TileOrientation);
+
+    // Automatically close popups
+    //if (pressed && !(flags & ImGuiButtonFlags_DontClosePopups) && (window->Flags & ImGuiWindowFlags_Popup))
+    //    CloseCurrentPopup();
+
+    IMGUI_TEST_ENGINE_ITEM_INFO(id, label, g.LastItemData.StatusFlags);
+    return pressed;
+}
+
+bool Domino2D::RenderTile(const char* label, bool OverrideMirror, ImGuiButtonFlags flags) const
+{
+    ImGui::PushStyleColor(ImGuiCol_Button, TileColor);
+    if (TileButton(label, OverrideMirror, flags)) {
+        ImGui::PopStyleColor();
+        return true;
+    }
+    ImGui::PopStyleColor();
+    return false;
+}
+
+bool Domino2D::RenderTransparentTile(const char* label, bool OverrideMirror, ImGuiButtonFlags flags) const
+{
+    using namespace ImGui;
+    ImGuiWindow* window = GetCurrentWindow();
+    if (window->SkipItems)
+        return false;
+
+    ImGuiContext& g = *GImGui;
+    const ImGuiStyle& style = g.Style;
+    const ImGuiID id = window->GetID(label);
+    const ImVec2 label_size = CalcTextSize(label, NULL, true);
+
+    ImVec2 pos = TilePos;
+    ImVec2 size = CalcItemSize(TileOrientation == TileOrientation_Vertical ? ImVec2(TileVecSize.y, TileVecSize.x) : TileVecSize, label_size.x + style.FramePadding.x * 2.0f, label_size.y + style.FramePadding.y * 2.0f);
+
+    const ImRect bb(pos, pos + size);
+    ItemSize(size, style.FramePadding.y);
+    if (!ItemAdd(bb, id))
+        return false;
+
+    if (g.LastItemData.InFlags & ImGuiItemFlags_ButtonRepeat)
+        flags |= ImGuiButtonFlags_Repeat;
+
+    bool hovered, held;
+    bool pressed = ButtonBehavior(bb, id, &hovered, &held, flags);
+
+    constexpr ImU32 tile_transparent_color = 2197815295;
+    constexpr ImU32 dot_transparent_color = 2181038080;
+    const bool Mirror = OverrideMirror ? !MirrorTile : MirrorTile;
+
+    // Render
+    const ImU32 col = held && hovered ? GetColorU32(ImGuiCol_ButtonActive) : (hovered ? GetColorU32(ImGuiCol_ButtonHovered) : tile_transparent_color);
+    RenderNavHighlight(bb, id);
+    RenderFrame(bb.Min, bb.Max, col, true, 3.0f * TileScale);
+
+    if (g.LogEnabled)
+        LogSetNextTextDecoration("[", "]");
+
+    domino_dots::leftDotNumber(Mirror ? right_number : left_number, pos, TileScale, dot_transparent_color, TileOrientation);
+    domino_dots::middleLine(TileLeftWidth, pos, TileScale, dot_transparent_color, TileOrientation);
+    domino_dots::rightDotNumber(Mirror ? left_number : right_number, TileLeftWidth, pos, TileScale, dot_transparent_color, TileOrientation);
+
+    // Automatically close popups
+    //if (pressed && !(flags & ImGuiButtonFlags_DontClosePopups) && (window->Flags & ImGuiWindowFlags_Popup))
+    //    CloseCurrentPopup();
+
+    IMGUI_TEST_ENGINE_ITEM_INFO(id, label, g.LastItemData.StatusFlags);
+    return pressed;
+}
+
+bool Domino2D::RenderTileIndependently(const char* label, const ImVec2& sz, const ImVec2& position, ImGuiButtonFlags flags) const
+{
+    using namespace ImGui;
+    ImGuiWindow* window = GetCurrentWindow();
+    if (window->SkipItems)
+        return false;
+
+    ImGuiContext& g = *GImGui;
+    const ImGuiStyle& style = g.Style;
+    const ImGuiID id = window->GetID(label);
+    const ImVec2 label_size = CalcTextSize(label, NULL, true);
+
+    ImVec2 pos = position;
+    if ((flags & ImGuiButtonFlags_AlignTextBaseLine) && style.FramePadding.y < window->DC.CurrLineTextBaseOffset) // Try to vertically align buttons that are smaller/have no padding so that text baseline matches (bit hacky, since it shouldn't be a flag)
+        pos.y += window->DC.CurrLineTextBaseOffset - style.FramePadding.y;
+    ImVec2 size = CalcItemSize(sz, label_size.x + style.FramePadding.x * 2.0f, label_size.y + style.FramePadding.y * 2.0f);
+
+    const ImRect bb(pos, pos + size);
+    ItemSize(size, style.FramePadding.y);
+    if (!ItemAdd(bb, id))
+        return false;
+
+    if (g.LastItemData.InFlags & ImGuiItemFlags_ButtonRepeat)
+        flags |= ImGuiButtonFlags_Repeat;
+
+    bool hovered, held;
+    bool pressed = ButtonBehavior(bb, id, &hovered, &held, flags);
+
+    // Render
+    //const ImU32 col = GetColorU32((held && hovered) ? ImGuiCol_ButtonActive : hovered ? ImGuiCol_ButtonHovered : ImGuiCol_Button);
+    const ImU32 col = held && hovered ? GetColorU32(ImGuiCol_ButtonActive) : (hovered ? GetColorU32(ImGuiCol_ButtonHovered) : TileColor);
+
+    const float scale = size.y / 21.0f;
+    const float halfwidth = size.y + 1;
+
+    RenderNavHighlight(bb, id);
+    RenderFrame(bb.Min, bb.Max, col, true, 3.0f * scale);
+
+    if (g.LogEnabled)
+        LogSetNextTextDecoration("[", "]");
+
+
+    domino_dots::leftDotNumber(left_number, pos, scale, DotColor, TileOrientation_Horizontal);
+    domino_dots::middleLine(halfwidth, pos, scale, DotColor, TileOrientation_Horizontal);
+    domino_dots::rightDotNumber(right_number, halfwidth, pos, scale, DotColor, TileOrientation_Horizontal);
+
+    // Automatically close popups
+    //if (pressed && !(flags & ImGuiButtonFlags_DontClosePopups) && (window->Flags & ImGuiWindowFlags_Popup))
+    //    CloseCurrentPopup();
+
+    IMGUI_TEST_ENGINE_ITEM_INFO(id, label, g.LastItemData.StatusFlags);
+    return pressed;
+}
+
+constexpr bool Domino2D::operator == (const Domino2D& DT) const
+{
+    return (left_number == DT.left_number && right_number == DT.right_number) || (right_number == DT.left_number && left_number == DT.right_number);
+}
+
+constexpr bool Domino2D::operator == (const DominoTile& other) const
+{
+    return (left_number == other.GetLeftNumber() && right_number == other.GetRightNumber()) || (right_number == other.GetLeftNumber() && left_number == other.GetRightNumber());
+}
+
+
+
+
+//-----------------------------------------------------------------------------------------------------------------------
+// PlayerDomino2D CLASS
+//-----------------------------------------------------------------------------------------------------------------------
+
+PlayerDomino2D::PlayerDomino2D(uint16_t player_number)
+{
+    this->PlayerNumber = player_number;
+}
+
+bool PlayerDomino2D::InitializePlayerDomino()
+{
+    if (this->PlayerNumber >= 8) {
+        return false;
+    }
+
+    return true;
+}
+
+void PlayerDomino2D::InitializeDominoParameters()
+{
+    TileColor       = &Domino2D::GetTileColor();
+    DotColor        = &Domino2D::GetDotColor();
+    ClickedColor    = 3432598886;
+    TileSize        = ImVec2(141.0f, 70.0f);
+    scale           = 70.0f / 21.0f;
+    HalfWidth       = 71.0f;
+    TilePositioning = ImVec2(23.0f, 540.0f);
+
+}
+
+bool PlayerDomino2D::PlayerDominoButton(Domino2D& DT, const char* label, const ImVec2& position, ImGuiButtonFlags flags)
+{
+    using namespace ImGui;
+    ImGuiWindow* window = GetCurrentWindow();
+    if (window->SkipItems)
+        return false;
+
+    ImGuiContext& g = *GImGui;
+    const ImGuiStyle& style = g.Style;
+    const ImGuiID id = window->GetID(label);
+    const ImVec2 label_size = CalcTextSize(label, NULL, true);
+
+    ImVec2 pos = position;
+    ImVec2 size = CalcItemSize(TileSize, label_size.x + style.FramePadding.x * 2.0f, label_size.y + style.FramePadding.y * 2.0f);
+
+    const ImRect bb(pos, pos + size);
+    ItemSize(size, style.FramePadding.y);
+    if (!ItemAdd(bb, id))
+        return false;
+
+    if (g.LastItemData.InFlags & ImGuiItemFlags_ButtonRepeat)
+        flags |= ImGuiButtonFlags_Repeat;
+
+    bool hovered, held;
+    bool pressed = ButtonBehavior(bb, id, &hovered, &held, flags);
+
+    // Render
+    //const ImU32 col = held && hovered ? GetColorU32(ImGuiCol_ButtonActive) : (hovered ? GetColorU32(ImGuiCol_ButtonHovered) : (DT.Clicked ? ClickedColor : *TileColor));
+    bool tile_selected = CurrentlyClickedCard == &DT;
+    const ImU32 col = (held && hovered) ? GetColorU32(ImGuiCol_ButtonActive) : hovered ? GetColorU32(ImGuiCol_ButtonHovered) : (tile_selected ? ClickedColor : GetColorU32(ImGuiCol_Button));
+
+    RenderNavHighlight(bb, id);
+    RenderFrame(bb.Min, bb.Max, col, true, 3.0f * scale);
+
+    if (g.LogEnabled)
+        LogSetNextTextDecoration("[", "]");
+
+    domino_dots::leftDotNumber(DT.GetLeftNumber(), pos, scale, *DotColor);
+    domino_dots::middleLine(HalfWidth, pos, scale, *DotColor);
+    domino_dots::rightDotNumber(DT.GetRightNumber(), HalfWidth, pos, scale, *DotColor);
+
+    // Automatically close popups
+    //if (pressed && !(flags & ImGuiButtonFlags_DontClosePopups) && (window->Flags & ImGuiWindowFlags_Popup))
+    //    CloseCurrentPopup();
+
+    IMGUI_TEST_ENGINE_ITEM_INFO(id, label, g.LastItemData.StatusFlags);
+    return pressed;
+
+    return true;
+}
+
+void PlayerDomino2D::ClearDominoes()
+{
+    PlayerCards.clear();
+}
+
+bool PlayerDomino2D::RenderPlayerDominoes()
+{
+    bool clicked    = false;
+    auto& dgs       = dvars::GameState;
+    ImVec2 position = TilePositioning;
+    bool first_tile_state = dgs.IsThereAChangeInPlayer() && dgs.GetNumberOfTurns() == 0;
+
+    for (size_t iter = 0; auto DT : PlayerCards) {
+        if (!DT->IsRemoved()) {
+            static const char* Label[] = { "PDB##1", "PDB##2", "PDB##3", "PDB##4", "PDB##5" };
+
+            ImGui::SameLine();
+            ImGui::BeginDisabled(first_tile_state && dgs.GetFirstTurnTile() != *DT); // Disable the tile in the first turn if it's not the first tile that needs to be used
+            ImGui::PushStyleColor(ImGuiCol_Button, *TileColor);
+            if (PlayerDominoButton(*DT, Label[iter], position)) {
+                clicked = true;
+                CurrentlyClickedCard = CurrentlyClickedCard == nullptr ? DT : (CurrentlyClickedCard == DT ? nullptr : DT);
+            }
+            if (ImGui::IsItemHovered() && first_tile_state && dgs.GetFirstTurnTile() == *DT) {
+                ImGui::BeginTooltip();
+                ImGui::PushTextWrapPos(150.0f);
+                ImGui::TextUnformatted("FIRST TURN TILE USE");
+                ImGui::PopTextWrapPos();
+                ImGui::EndTooltip();
+            }
+            ImGui::PopStyleColor();
+            ImGui::EndDisabled();
+        }
+
+        position = ImVec2(position.x + 152.0f, position.y);
+        iter++;
+    }
+
+    return clicked;
+}
+
+// FOR DEBUGGING PURPOSES
+#ifdef _DEBUG
+void PlayerDomino2D::ChangeTilePositioning(float _x, float _y)
+{
+    TilePositioning = ImVec2(_x, _y);
+}
+
+ImVec2 PlayerDomino2D::GetTilePosition()
+{
+    return TilePositioning;
+}
+#endif // DEBUG
+
+
+
+
+//-----------------------------------------------------------------------------------------------------------------------
+// GameBoardDominoes CLASS
+//-----------------------------------------------------------------------------------------------------------------------
+
+void GameBoardDominoes::AddFirstDomino(Domino2D& d)
+{
+    FirstDomino = &d;
+}
+
+void GameBoardDominoes::AddLeftDomino(Domino2D& d)
+{
+    LeftSideDominoes.push_back(&d);
+}
+
+void GameBoardDominoes::AddRightDomino(Domino2D& d)
+{
+    RightSideDominoes.push_back(&d);
+}
+
+bool GameBoardDominoes::NoDominoesYet() const
+{
+    return FirstDomino == nullptr;
+}
+
+Domino2D* GameBoardDominoes::GetLatestLeftSideDomino()
+{
+    return LeftSideDominoes.back();
+}
+
+Domino2D* GameBoardDominoes::GetLatestRightSideDomino()
+{
+    return RightSideDominoes.back();
+}
+
+Domino2D* GameBoardDominoes::GetFirstDomino()
+{
+    return FirstDomino;
+}
+
+bool GameBoardDominoes::EmptyLeftSideDominoes() const
+{
+    return LeftSideDominoes.empty();
+}
+
+bool GameBoardDominoes::EmptyRightSideDominoes() const
+{
+    return RightSideDominoes.empty();
+}
+
+void GameBoardDominoes::RenderBoardDominoes()
+{
+    static const char* LeftDominoLabel[] = { "a##ls", "b##ls", "c##ls", "d##ls", "e##ls", "f##ls",
+                                              "g##ls", "h##ls", "i##ls", "j##ls", "k##ls", "l##ls",
+                                              "m##ls", "n##ls", "o##ls", "p##ls", "q##ls", "r##ls", "s##ls", "t##ls" };
+    static const char* RightDominoLabel[] = { "a##rs", "b##rs", "c##rs", "d##rs", "e##rs", "f##rs",
+                                              "g##rs", "h##rs", "i##rs", "j##rs", "k##rs", "l##rs",
+                                              "m##rs", "n##rs", "o##rs", "p##rs", "q##rs", "r##rs", "s##rs", "t##rs" };
+
+    // Render the first domino. The center most domino
+    FirstDomino->RenderTile("First Domino", false);
+
+    // Render the left side dominoes
+    for (int i = 0; auto & DT : LeftSideDominoes) {
+        ImGui::SameLine();
+        DT->RenderTile(LeftDominoLabel[i], i > 6);
+        i++;
+    }
+
+    // Render the right side dominoes
+    for (int i = 0; auto & DT : RightSideDominoes) {
+        ImGui::SameLine();
+        DT->RenderTile(RightDominoLabel[i], i > 6);
+        i++;
+    }
+}
+
+void GameBoardDominoes::ClearBoardDominoes()
+{
+    FirstDomino = nullptr;
+    LeftSideDominoes.clear();
+    RightSideDominoes.clear();
+}
+
+size_t GameBoardDominoes::LeftSideSize() const
+{
+    return LeftSideDominoes.size();
+}
+
+size_t GameBoardDominoes::RightSideSize() const
+{
+    return RightSideDominoes.size();
+}
+
+
+
+//-----------------------------------------------------------------------------------------------------------------------
+// DominoAI CLASS
+//-----------------------------------------------------------------------------------------------------------------------
+
+DominoAI::DominoAI(Player* p_data, Player* ai_data, uint16_t ai_difficulty)
+{
+    this->SetAIData(p_data, ai_data);
+    this->SetDifficulty(ai_difficulty);
+}
+
+DominoAI::~DominoAI()
+{
+    this->StopPondering();
+    this->EndThinking();
+}
+
+void DominoAI::SetAIData(Player* p_data, Player* ai_data)
+{
+    this->AIData = ai_data;
+    this->PlayerData = p_data;
+}
+
+void DominoAI::SetDifficulty(uint16_t ai_difficulty)
+{
+    this->StopPondering();
+    this->EndThinking();
+    this->AIDifficulty = ai_difficulty;
+
+    if (ai_difficulty != AIDifficulty_Random && !WeightsLoaded) {
+        WeightsLoaded = true;
+        Evaluator.LoadWeights("domino_weights.txt");
+    }
+}
+
+void DominoAI::AIAttack()
+{
+    if (this->FirstTurnAIAttack() || this->PlayThoughtMove()) {
+        return;
+    }
+
+    switch (this->AIDifficulty)
+    {
+    case AIDifficulty_Random:    this->RandomCompute();    return;
+    case AIDifficulty_Normal:    this->NormalCompute();    return;
+    case AIDifficulty_Hard:      this->HardCompute();      return;
+    case AIDifficulty_GigaBrain: this->GigaBrainCompute(); return;
+    default: return;
+    }
+}
+
+bool DominoAI::FirstTurnAIAttack()
+{
+    if (!dvars::GameState.IsThereAChangeInPlayer() || dvars::GameState.GetNumberOfTurns() != 0) {
+        return false;
+    }
+
+    auto& dgs = dvars::GameState;
+    auto& ai_cards = this->AIData->GetPlayerCards();
+    for (auto& ai_card : ai_cards) {
+        if (*ai_card != dgs.GetFirstTurnTile()) {
+            continue;
+        }
+
+        ai_card->SetAsFirstDomino();
+        dgs.AddBoardDominoes(*ai_card, TileDropPosition_Left);
+        break;
+    }
+
+    return true;
+}
+
+void DominoAI::RandomCompute()
+{
+    auto& dgs = dvars::GameState;
+    auto& ai_cards = AIData->GetPlayerCards();
+    const auto& seed = std::chrono::steady_clock::now().time_since_epoch().count();
+    std::mt19937_64 rng(seed);
+    std::shuffle(ai_cards.begin(), ai_cards.end(), rng);
+
+    for (auto ai_card : ai_cards) {
+        if (ai_card->IsRemoved()) {
+            continue;
+        }
+        if (dgs.NoDominoesYet()) {
+            ai_card->SetAsFirstDomino();
+            dgs.AddBoardDominoes(*ai_card, TileDropPosition_Left);
+            return;
+        }
+        if (ai_card->ConnectDomino(dgs.EmptyRightSideDominoes() ? *dgs.GetFirstDomino() : *dgs.GetLatestRightSideDomino(), TileDropPosition_Right)) {
+            dgs.AddBoardDominoes(*ai_card, TileDropPosition_Right);
+            return;
+        }
+        // Will use the first usable card and will attack on the left side
+        if (ai_card->ConnectDomino(dgs.EmptyLeftSideDominoes() ? *dgs.GetFirstDomino() : *dgs.GetLatestLeftSideDomino(), TileDropPosition_Left)) {
+            dgs.AddBoardDominoes(*ai_card, TileDropPosition_Left);
+            return;
+        }
+        // And if not possible, then on the right
+        // Otherwise, continue with loop and repeat
+    }
+}
+
+// Greedy one move look ahead with the trained evaluator
+void DominoAI::NormalCompute()
+{
+    const DominoEngine& engine = dvars::GameState.GetEngineState();
+
+    const auto& seed = std::chrono::steady_clock::now().time_since_epoch().count();
+    std::mt19937 rng(static_cast<uint32_t>(seed));
+    if (!dvars::GameState.AttackWithMove(Evaluator.SelectMove(engine, rng))) {
+        this->RandomCompute();
+    }
+}
+
+// Expectimax over sampled deals of the hidden hands
+void DominoAI::HardCompute()
+{
+    if (!dvars::GameState.AttackWithMove(this->HardMove(dvars::GameState.GetEngineState(), nullptr))) {
+        this->RandomCompute();
+    }
+}
+
+// Information set MCTS. Every AI seat keeps its tree and moves it along the logged moves of the turns in between, so
+// the search goes on from the subtree of the position it's at
+void DominoAI::GigaBrainCompute()
+{
+    this->StopPondering();
+
+    const DominoEngine& engine = dvars::GameState.GetEngineState();
+    if (!dvars::GameState.AttackWithMove(this->GigaBrainMove(this->SeatSearch(engine.GetCurrentTurn()), engine, nullptr))) {
+        this->RandomCompute();
+    }
+}
+
+DominoMove DominoAI::HardMove(const DominoEngine& engine, const TimeManager* time)
+{
+    const auto& seed = std::chrono::steady_clock::now().time_since_epoch().count();
+    std::mt19937 rng(static_cast<uint32_t>(seed));
+    SearchLimits limits;
+    limits.Threads = std::max(1u, std::thread::hardware_concurrency());
+    if (time != nullptr) {
+        // As many deals as the clock allows
+        limits.Determinizations = 512;
+    }
+    DominoSearch search(Evaluator, limits);
+    search.SetTranspositionTable(&dvars::SearchTable);
+    search.SetTablebase(&dvars::EndgameTables[engine.GetNumberOfPlayers()]);
+    search.SetTimeManager(time);
+    return search.ExpectiMax(engine, rng).Move;
+}
+
+DominoMove DominoAI::GigaBrainMove(DominoSearch& search, const DominoEngine& engine, const TimeManager* time)
+{
+    const auto& seed = std::chrono::steady_clock::now().time_since_epoch().count();
+    std::mt19937 rng(static_cast<uint32_t>(seed));
+    SearchLimits limits;
+    if (time != nullptr) {
+        // As many iterations as the clock allows, the tree stops growing at its memory limit
+        limits.Iterations = 1 << 20;
+    }
+    search.SetLimits(limits);
+    search.SetTimeManager(time);
+    return search.Mcts(engine, rng).Move;
+}
+
+DominoSearch& DominoAI::SeatSearch(uint16_t seat)
+{
+    const DominoLogs& logs = dvars::GameState.GetGameLogs();
+    while (SeatSearches.size() <= seat) {
+        SeatSearches.emplace_back(Evaluator);
+        SeatLogs.push_back(0);
+    }
+
+    DominoSearch& search = SeatSearches[seat];
+    search.SetTablebase(&dvars::EndgameTables[dvars::GameState.GetNumberOfPlayers()]);
+    if (logs.GetNumberOfLogs() < SeatLogs[seat]) {
+        // A new game
+        search.ForgetTree();
+        SeatLogs[seat] = 0;
+    }
+    for (; SeatLogs[seat] < logs.GetNumberOfLogs(); SeatLogs[seat]++) {
+        search.AdvanceTree(logs.GetEngineMove(SeatLogs[seat]));
+    }
+    return search;
+}
+
+void DominoAI::StartPondering(bool hints)
+{
+    auto& dgs = dvars::GameState;
+    const uint32_t version = dgs.GetStateVersion();
+    const bool     ponder  = this->AIDifficulty == AIDifficulty_GigaBrain;
+    if (!ponder && !hints) {
+        this->StopPondering();
+        return;
+    }
+    if (PonderThread.joinable() && version == PonderVersion && hints == PonderHints) {
+        return;
+    }
+    this->StopPondering();
+    this->EndThinking();
+
+    // The seat after the human player searches from its own point of view with the human to move. The human's move,
+    // a pass too, is followed by SeatSearch on the seat's turn, which then starts from the pondered subtree. Both
+    // searches are made before taking their addresses, SeatSearch can grow the vector
+    const DominoEngine& engine = dgs.GetEngineState();
+    const uint16_t      human  = engine.GetCurrentTurn();
+    const uint16_t      seat   = (human + 1) % dgs.GetNumberOfPlayers();
+    DominoMove          forced;
+    this->SeatSearch(human);
+    this->SeatSearch(seat);
+    DominoSearch* ponder_search = ponder ? &SeatSearches[seat] : nullptr;
+    DominoSearch* hint_search   = hints && !engine.GetForcedMove(forced) ? &SeatSearches[human] : nullptr;
+
+    PonderVersion = version;
+    PonderHints   = hints;
+    PonderStop    = false;
+    const uint32_t iterations = std::max(ponder ? PonderIterations : 0, hint_search != nullptr ? HintIterations : 0);
+    const auto&    seed       = std::chrono::steady_clock::now().time_since_epoch().count();
+    PonderThread = std::thread([this, ponder_search, hint_search, engine, human, seat, version, iterations, seed]() {
+        std::mt19937 rng(static_cast<uint32_t>(seed));
+        std::array<RootMove, dengine::MaxMoves> hints;
+        for (uint32_t done = 0; done < iterations; done += PonderSlice) {
+            if (PonderStop) {
+                return;
+            }
+            const auto start = std::chrono::steady_clock::now();
+            if (ponder_search != nullptr && done < PonderIterations) {
+                ponder_search->Ponder(engine, seat, PonderSlice, rng);
+            }
+            if (hint_search != nullptr && done < HintIterations) {
+                hint_search->Ponder(engine, human, PonderSlice, rng);
+                const uint16_t count = hint_search->GetRootMoves(hints);
+                std::lock_guard lock(HintMutex);
+                Hints         = hints;
+                NumberOfHints = count;
+                HintVersion   = version;
+            }
+            std::this_thread::sleep_for(std::chrono::steady_clock::now() - start);
+        }
+    });
+}
+
+void DominoAI::StopPondering()
+{
+    if (!PonderThread.joinable()) {
+        return;
+    }
+
+    PonderStop = true;
+    PonderThread.join();
+}
+
+bool DominoAI::StartThinking(float budget)
+{
+    auto& dgs = dvars::GameState;
+    const bool searches = this->AIDifficulty == AIDifficulty_Hard || this->AIDifficulty == AIDifficulty_GigaBrain;
+    if (!searches || (dgs.IsThereAChangeInPlayer() && dgs.GetNumberOfTurns() == 0)) {
+        return false;
+    }
+
+    this->StopPondering();
+    this->EndThinking();
+
+    const DominoEngine& engine = dgs.GetEngineState();
+    DominoSearch*       search = this->AIDifficulty == AIDifficulty_GigaBrain ? &this->SeatSearch(engine.GetCurrentTurn()) : nullptr;
+    ThinkVersion = dgs.GetStateVersion();
+    ThinkDone    = false;
+    ThinkTime.SetBudget(budget);
+    ThinkTime.StartMove(engine);
+    ThinkThread = std::thread([this, search, engine]() {
+        ThinkMove = search != nullptr ? this->GigaBrainMove(*search, engine, &ThinkTime) : this->HardMove(engine, &ThinkTime);
+        ThinkDone = true;
+    });
+    return true;
+}
+
+bool DominoAI::IsThinking() const
+{
+    return ThinkThread.joinable() && !ThinkDone;
+}
+
+uint16_t DominoAI::GetHints(std::array<RootMove, dengine::MaxMoves>& hints) const
+{
+    std::lock_guard lock(HintMutex);
+    if (HintVersion != dvars::GameState.GetStateVersion()) {
+        return 0;
+    }
+    hints = Hints;
+    return NumberOfHints;
+}
+
+bool DominoAI::PlayThoughtMove()
+{
+    if (!ThinkThread.joinable()) {
+        return false;
+    }
+
+    ThinkThread.join();
+    if (ThinkVersion != dvars::GameState.GetStateVersion()) {
+        return false;
+    }
+    if (!dvars::GameState.AttackWithMove(ThinkMove)) {
+        this->RandomCompute();
+    }
+    return true;
+}
+
+void DominoAI::EndThinking()
+{
+    if (!ThinkThread.joinable()) {
+        return;
+    }
+
+    ThinkTime.Stop();
+    ThinkThread.join();
+}
+
+
+
+//-----------------------------------------------------------------------------------------------------------------------
+// WinMeter CLASS
+//-----------------------------------------------------------------------------------------------------------------------
+
+WinMeter::~WinMeter()
+{
+    if (!Thread.joinable()) {
+        return;
+    }
+
+    {
+        std::lock_guard lock(Mutex);
+        Quit = true;
+    }
+    Wake.notify_one();
+    Thread.join();
+}
+
+void WinMeter::SetCpuShare(float share)
+{
+    {
+        std::lock_guard lock(Mutex);
+        CpuShare = std::clamp(share, 0.0f, 1.0f);
+    }
+    Wake.notify_one();
+}
+
+float WinMeter::GetCpuShare() const
+{
+    std::lock_guard lock(Mutex);
+    return CpuShare;
+}
+
+void WinMeter::Update(const DominoEngine& engine, uint32_t version)
+{
+    std::unique_lock lock(Mutex, std::try_to_lock);
+    if (!lock.owns_lock() || version == PositionVersion) {
+        return;
+    }
+
+    // A new game starts over, a move keeps some of what the rollouts said before it
+    const bool new_game = engine.GetNumberOfTurns() == 0 || engine.GetNumberOfPlayers() != Position.GetNumberOfPlayers();
+    const float weight  = new_game ? 0.0f : Decay;
+    for (float& wins : Wins) {
+        wins *= weight;
+    }
+    Rollouts        *= weight;
+    Position         = engine;
+    PositionVersion  = version;
+    lock.unlock();
+
+    if (!Thread.joinable()) {
+        Evaluator.LoadWeights("domino_weights.txt");
+        Thread = std::thread(&WinMeter::RolloutLoop, this);
+    }
+    Wake.notify_one();
+}
+
+bool WinMeter::GetWinProbabilities(std::array<float, dengine::MaxPlayers>& probabilities, float& rollouts) const
+{
+    std::unique_lock lock(Mutex, std::try_to_lock);
+    if (!lock.owns_lock()) {
+        return false;
+    }
+
+    for (uint16_t p = 0; p < dengine::MaxPlayers; p++) {
+        probabilities[p] = Rollouts > 0.0f ? Wins[p] / Rollouts : 0.0f;
+    }
+    rollouts = Rollouts;
+    return true;
+}
+
+void WinMeter::RolloutLoop()
+{
+    std::mt19937 rng(static_cast<uint32_t>(std::chrono::steady_clock::now().time_since_epoch().count()));
+    DominoEngine world;
+    std::unique_lock lock(Mutex);
+    while (!Quit) {
+        if (CpuShare <= 0.0f || Position.IsGameOver() || Rollouts >= MaxRollouts) {
+            Wake.wait(lock);
+            continue;
+        }
+
+        // The rollouts run on a copy of the position without the lock
+        const DominoEngine engine  = Position;
+        const uint32_t     version = PositionVersion;
+        lock.unlock();
+
+        const Tablebase& endgame = dvars::EndgameTables[engine.GetNumberOfPlayers()];
+        const auto       start   = std::chrono::steady_clock::now();
+        std::array<float, dengine::MaxPlayers> wins{};
+        for (uint32_t r = 0; r < RolloutBatch; r++) {
+            // The endgame table, when there's one, finishes the rollout with perfect play
+            DominoSearch::Determinize(engine, 0, world, rng);
+            uint16_t winner;
+            while (!world.IsGameOver() && !endgame.Probe(world, winner)) {
+                world.PlayMove(Evaluator.SelectMove(world, rng, Explore));
+            }
+            wins[world.IsGameOver() ? world.GetWinner() : winner]++;
+        }
+        const auto worked = std::chrono::steady_clock::now() - start;
+
+        lock.lock();
+        if (version == PositionVersion) {
+            for (uint16_t p = 0; p < dengine::MaxPlayers; p++) {
+                Wins[p] += wins[p];
+            }
+            Rollouts += RolloutBatch;
+        }
+        // Rest for the rest of the duty cycle
+        if (CpuShare < 1.0f) {
+            Wake.wait_for(lock, worked * ((1.0f - CpuShare) / std::max(CpuShare, 0.01f)), [this]() { return Quit; });
+        }
+    }
+}
+
+
+
+//-----------------------------------------------------------------------------------------------------------------------
+// GameReview CLASS
+//-----------------------------------------------------------------------------------------------------------------------
+
+GameReview::~GameReview()
+{
+    this->Cancel();
+}
+
+bool GameReview::Start(const DominoEngine& start, const DominoLogs& logs)
+{
+    this->Cancel();
+
+    const size_t moves = logs.GetNumberOfLogs();
+    Positions.resize(moves);
+    Played.resize(moves);
+    Reviews = std::vector<MoveReview>(moves);
+    DominoEngine engine = start;
+    for (size_t i = 0; i < moves; i++) {
+        Positions[i] = engine;
+        Played[i]    = logs.GetEngineMove(i);
+        if (engine.IsGameOver() || engine.GetCurrentTurn() + 1 != logs.GetPlayerNumber(i)) {
+            Reviews.clear();
+            return false;
+        }
+        engine.PlayMove(Played[i]);
+    }
+
+    if (!WeightsLoaded) {
+        WeightsLoaded = true;
+        Evaluator.LoadWeights("domino_weights.txt");
+    }
+    NextTask = 0;
+    Finished = 0;
+    Stop     = false;
+    const uint32_t threads = std::max(1u, std::thread::hardware_concurrency());
+    for (uint32_t t = 0; t < std::min<size_t>(threads, moves); t++) {
+        Workers.emplace_back(&GameReview::ReviewLoop, this);
+    }
+    return true;
+}
+
+void GameReview::Cancel()
+{
+    Stop = true;
+    for (std::thread& worker : Workers) {
+        worker.join();
+    }
+    Workers.clear();
+    Reviews.clear();
+}
+
+size_t GameReview::GetNumberOfMoves() const
+{
+    return Reviews.size();
+}
+
+size_t GameReview::GetNumberOfFinished() const
+{
+    return Finished;
+}
+
+const MoveReview* GameReview::GetReview(size_t log) const
+{
+    return log < Reviews.size() ? &Reviews[log] : nullptr;
+}
+
+void GameReview::ReviewLoop()
+{
+    std::mt19937 rng(static_cast<uint32_t>(std::chrono::steady_clock::now().time_since_epoch().count()));
+    SearchLimits limits;
+    limits.Iterations = ReviewIterations;
+    DominoSearch search(Evaluator, limits);
+    search.SetTablebase(&dvars::EndgameTables[Positions.front().GetNumberOfPlayers()]);
+    for (size_t log = NextTask++; log < Reviews.size() && !Stop; log = NextTask++) {
+        this->ReviewMove(log, search, rng);
+        Finished++;
+    }
+}
+
+void GameReview::ReviewMove(size_t log, DominoSearch& search, std::mt19937& rng)
+{
+    const DominoEngine& engine = Positions[log];
+    MoveReview&         review = Reviews[log];
+    DominoMove          forced;
+    if (engine.GetForcedMove(forced)) {
+        review.Verdict.store(ReviewVerdict_Forced, std::memory_order_release);
+        return;
+    }
+
+    // Every position is searched from scratch, the positions of one worker don't follow each other
+    search.ForgetTree();
+    search.Mcts(engine, rng);
+    std::array<RootMove, dengine::MaxMoves> moves;
+    const uint16_t number_of_moves = search.GetRootMoves(moves);
+
+    // The search plays a tile on the left when both open ends show the same pip
+    DominoMove played = Played[log];
+    if (played.Side == EngineSide_Right && (engine.NoDominoesYet() || engine.GetLeftEnd() == engine.GetRightEnd())) {
+        played.Side = EngineSide_Left;
+    }
+    ReviewVerdict verdict = ReviewVerdict_Good;
+    if (number_of_moves > 0) {
+        review.Best        = moves[0].Move;
+        review.BestValue   = moves[0].Value;
+        review.PlayedValue = moves[0].Value;
+        for (uint16_t i = 0; i < number_of_moves; i++) {
+            if (moves[i].Move == played) {
+                review.PlayedValue = moves[i].Value;
+            }
+        }
+        if (review.BestValue >= ReviewSureWin && review.PlayedValue < ReviewSureWin - ReviewBlunder) {
+            verdict = ReviewVerdict_MissedWin;
+        }
+        else if (review.BestValue - review.PlayedValue >= ReviewBlunder) {
+            verdict = ReviewVerdict_Blunder;
+        }
+    }
+    review.Verdict.store(verdict, std::memory_order_release);
+}
+
+
+
+//-----------------------------------------------------------------------------------------------------------------------
+// DominoLogs CLASS
+//-----------------------------------------------------------------------------------------------------------------------
+
+void DominoLogs::AddLog(const Domino2D* d, uint16_t player_number, LogMove player_move, const DominoMove& engine_move)
+{
+    LogData.push_back(AttackLog(d, player_number, player_move, engine_move));
+}
+
+void DominoLogs::ClearLog()
+{
+    LogData.clear();
+}
+
+size_t DominoLogs::GetNumberOfLogs() const
+{
+    return LogData.size();
+}
+
+DominoMove DominoLogs::GetEngineMove(size_t log) const
+{
+    return LogData[log].EngineMove;
+}
+
+uint16_t DominoLogs::GetPlayerNumber(size_t log) const
+{
+    return LogData[log].PlayerNumber;
+}
+
+void DominoLogs::RenderMoveReview(const MoveReview& review)
+{
+    // The rest of the review is only written before the verdict
+    const ReviewVerdict verdict = review.Verdict.load(std::memory_order_acquire);
+    if (verdict == ReviewVerdict_Pending) {
+        ImGui::TextDisabled("Reviewing...");
+        return;
+    }
+    if (verdict == ReviewVerdict_Forced) {
+        ImGui::TextDisabled("Forced");
+        return;
+    }
+
+    const dengine::TileNumbers& best = dengine::Tiles[review.Best.Tile];
+    const char*                 side = review.Best.Side == EngineSide_Left ? "left" : "right";
+    switch (verdict)
+    {
+    case ReviewVerdict_Good:
+        ImGui::TextColored(ImVec4(0.4f, 0.8f, 0.4f, 1.0f), "Good, %.0f%% to win", review.PlayedValue * 100.0f);
+        return;
+    case ReviewVerdict_Blunder:
+        ImGui::TextColored(ImVec4(0.9f, 0.6f, 0.2f, 1.0f), "Blunder: %.0f%%, %d-%d %s had %.0f%%", review.PlayedValue * 100.0f, best.Left, best.Right, side, review.BestValue * 100.0f);
+        return;
+    case ReviewVerdict_MissedWin:
+        ImGui::TextColored(ImVec4(0.9f, 0.3f, 0.3f, 1.0f), "Missed win: %d-%d %s had %.0f%%", best.Left, best.Right, side, review.BestValue * 100.0f);
+        return;
+    default:
+        return;
+    }
+}
+
+void DominoLogs::RenderLog(int NumberOfTurn, const GameReview* review)
+{
+    if (NumberOfTurn == -1) {
+        // Render all logs
+        static const auto domino_sz = ImVec2(121.0f, 60.0f);
+        std::string DominoLabels = "DT##0";
+
+        for (size_t i = 0; auto & logs : LogData) {
+            logs.PlayerMove == LogMove_TurnAttack ? ImGui::Text("Turn %d: Player %d attacked with:", i, logs.PlayerNumber) : ImGui::Text("Turn %d: Player %d passed", i, logs.PlayerNumber);
+            const MoveReview* move_review = review != nullptr ? review->GetReview(i) : nullptr;
+            if (move_review != nullptr) {
+                RenderMoveReview(*move_review);
+            }
+            if (logs.DominoUsed != nullptr) {
+                const auto& domino_pos = ImGui::GetCurrentWindow()->DC.CursorPos;
+                logs.DominoUsed->RenderTileIndependently(DominoLabels.c_str(), domino_sz, domino_pos);
+            }
+
+            i++;
+            ImGui::Separator();
+        }
+        return;
+    }
+
+    ImGui::BeginGroup(); {
+        constexpr ImVec2 LogDominoSize = ImVec2(141.0f, 70.0f);
+        const auto& CurrentLog = LogData[NumberOfTurn];
+        if (CurrentLog.DominoUsed == nullptr) {
+            ImGui::Text("Player %d passed!", CurrentLog.PlayerNumber);
+            ImGui::EndGroup();
+            return;
+        }
+
+        ImGui::Text("Player %d attacked with:", CurrentLog.PlayerNumber);
+        ImGuiWindow* window = ImGui::GetCurrentWindow();
+        const ImVec2& pos = window->DC.CursorPos;
+        ImGui::BeginDisabled(); {
+            CurrentLog.DominoUsed->RenderTileIndependently("Current Log", LogDominoSize, pos);
+        } ImGui::EndDisabled();
+    } ImGui::EndGroup();
+}
+
+
+
+//-----------------------------------------------------------------------------------------------------------------------
+// DominoGameStructure CLASS
+//-----------------------------------------------------------------------------------------------------------------------
+static void ResetGameDominoes()
+{
+    for (auto& GD : dvars::GameDominoes) {
+        GD.ResetParameters();
+    }
+}
+
+// Shuffles from the canonical order so the same seed always deals the same hands, the same as DominoEngine::NewGame
+static void ShuffleGameDominoes(uint32_t seed)
+{
+    ResetGameDominoes();
+    std::sort(dvars::GameDominoes.begin(), dvars::GameDominoes.end(), [](const Domino2D& a, const Domino2D& b) {
+        return dengine::TileIndex(a.GetLeftNumber(), a.GetRightNumber()) < dengine::TileIndex(b.GetLeftNumber(), b.GetRightNumber());
+    });
+    std::mt19937 rng(seed);
+    std::shuffle(dvars::GameDominoes.begin(), dvars::GameDominoes.end(), rng);
+}
+
+DominoGameStructure::DominoGameStructure() :
+    Players({
+            PlayerDomino2D(0),
+            PlayerDomino2D(1),
+            PlayerDomino2D(2),
+            PlayerDomino2D(3),
+            PlayerDomino2D(4),
+            PlayerDomino2D(5),
+            PlayerDomino2D(6),
+            PlayerDomino2D(7)
+        }),
+    NumberOfPlayers(0),
+    NumberOfTurns(0),
+    StateVersion(0),
+    CacheVersion(UINT32_MAX)
+{
+    TileOwner.fill(TileOwner_None);
+}
+
+bool DominoGameStructure::InitializeGame(const uint16_t & number_of_players, const uint16_t& ai_difficulty, const bool& change_player)
+{
+    // Check if the number of players is eligible for the game
+    if (number_of_players < 4 || number_of_players > 8) {
+        GameInitialized = false;
+        return false;
+    }
+
+    // Set the AI difficulty
+    this->AIPlayerLogic.SetDifficulty(ai_difficulty);
+
+    // The win meter and the review of the last game can still be probing this table, they miss until it's mapped
+    dvars::EndgameTables[number_of_players].Open(Tablebase::DefaultPath(number_of_players).c_str());
+
+    // In domino, whenever there is a change in player (a player leaves, a player joins, a player leaves but another joins at the same time), the first player will change
+    ChangeInPlayers = NumberOfPlayers != number_of_players || change_player;
+    NumberOfPlayers = number_of_players;
+    NumberOfCards   = number_of_players == 4 ? 5 : (number_of_players > 6 ? 3 : 4);
+
+    this->DistributeCards();
+
+    if (PlayerOneAlwaysFirst) {
+        CurrentTurn = FirstTurn = 0;
+        ChangeInPlayers = false;
+    }
+    else {
+        if (ChangeInPlayers) 
+            this->FindFirstPlayerTurn();
+        else                 
+            CurrentTurn = FirstTurn = PlayerWinner;
+    }
+
+    GameInitialized = true;
+    StateVersion++;
+    return true;
+}
+
+void DominoGameStructure::SetPlayerOneAsFirstTurn(bool enable)
+{
+    this->PlayerOneAlwaysFirst = enable;
+}
+
+bool DominoGameStructure::CheckGameState()
+{
+    // Check if the current player already won
+    if (Players[CurrentTurn].NumberOfCards() == 0) {
+        PlayerWinner = CurrentTurn;
+        return true;
+    }
+
+    if (NumberOfPasses == NumberOfPlayers + 1 || NobodyCanAttack()) {
+        FindTheLowestSum();
+        return true;
+    }
+
+    return false;
+}
+
+bool DominoGameStructure::NobodyCanAttack()
+{
+    if (NoDominoesYet()) {
+        return false;
+    }
+
+    // The pip numbers left in every hand against the open ends, the same check DominoEngine does after every attack
+    uint16_t held_pips = 0;
+    for (uint16_t p = 0; p < NumberOfPlayers; p++) {
+        for (const auto* card : Players[p].GetPlayerCards()) {
+            if (!card->IsRemoved()) {
+                held_pips |= (1 << card->GetLeftNumber()) | (1 << card->GetRightNumber());
+            }
+        }
+    }
+
+    const auto* left_domino  = EmptyLeftSideDominoes()  ? GetFirstDomino() : GetLatestLeftSideDomino();
+    const auto* right_domino = EmptyRightSideDominoes() ? GetFirstDomino() : GetLatestRightSideDomino();
+    const uint16_t end_pips  = (1 << left_domino->GetSideNumber(TileDropPosition_Left)) | (1 << right_domino->GetSideNumber(TileDropPosition_Right));
+    return !(held_pips & end_pips);
+}
+
+bool DominoGameStructure::IsThereAChangeInPlayer()
+{
+    return ChangeInPlayers;
+}
+
+DominoTile DominoGameStructure::GetFirstTurnTile() const
+{
+    return FirstTurnTileAttack;
+}
+
+void DominoGameStructure::PassCurrentTurn()
+{
+    this->AddGameLogs(nullptr, CurrentTurn + 1, LogMove_TurnPassed);
+    TurnAdvance();
+    NumberOfPasses++;
+    StateVersion++;
+}
+
+PlayerDomino2D& DominoGameStructure::GetPlayerData(uint16_t pnum)
+{
+    return Players[pnum];
+}
+
+uint16_t DominoGameStructure::GetCurrentTurn() const
+{
+    return CurrentTurn;
+}
+
+void DominoGameStructure::SetNoClickedCard()
+{
+    Players[0].SetClickedCard(nullptr);
+}
+
+void DominoGameStructure::DistributeCards()
+{
+    int end_domino = 0;
+    DealSeed = static_cast<uint32_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+    ShuffleGameDominoes(DealSeed);
+    TileOwner.fill(TileOwner_None);
+
+    for (int p_idx = 0; p_idx < NumberOfPlayers; p_idx++) {
+        auto& CurrentPlayer = Players[p_idx]; // Reference for the current player for readability
+        CurrentPlayer.ClearCards();
+
+        int starting_domino = end_domino;		// Create the starting domino index and the end domino index for distribution
+        end_domino += NumberOfCards;
+
+        for (int current_domino = starting_domino; current_domino < end_domino; current_domino++) {
+            auto& domino = dvars::GameDominoes[current_domino];
+            CurrentPlayer.SetCard(domino);
+            TileOwner[dengine::TileIndex(domino.GetLeftNumber(), domino.GetRightNumber())] = static_cast<uint8_t>(p_idx);
+        }
+        CurrentPlayer.InitializePlayerDomino();
+    }
+}
+
+void DominoGameStructure::FindFirstPlayerTurn()
+{
+    // Finding the player that has the double number starting from 6 to 1
+    for (int i = 6; i > 0; i--) {
+        const uint8_t owner = TileOwner[dengine::TileIndex(i, i)];
+        if (owner < NumberOfPlayers) {
+            CurrentTurn = FirstTurn = owner;
+            FirstTurnTileAttack = DominoTile(i, i);
+            return;
+        }
+    }
+
+    // If there is no one who has the double number, find the player who has the highest card 
+    for (int i = 6; i > 0; i--) {
+        for (int j = i - 1; j >= 0; j--) {
+            const uint8_t owner = TileOwner[dengine::TileIndex(i, j)];
+            if (owner < NumberOfPlayers) {
+                CurrentTurn = FirstTurn = owner;
+                FirstTurnTileAttack = DominoTile(i, j);
+                return;
+            }
+        }
+    }
+}
+
+void DominoGameStructure::FindTheLowestSum()
+{
+    // Walk the players in turn order starting from the first turn player so the earlier turn wins the ties
+    uint16_t current_winner = FirstTurn;
+    uint16_t lowest_sum     = Players[current_winner].SumOfCards();
+    uint16_t lowest_cards   = Players[current_winner].NumberOfCards();
+
+    for (uint16_t offset = 1; offset < NumberOfPlayers; offset++) {
+        const uint16_t i             = (FirstTurn + offset) % NumberOfPlayers;
+        const uint16_t current_sum   = Players[i].SumOfCards();
+        const uint16_t current_cards = Players[i].NumberOfCards();
+
+        if (current_sum < lowest_sum || (current_sum == lowest_sum && current_cards < lowest_cards)) [[unlikely]] {
+            lowest_sum     = current_sum;
+            lowest_cards   = current_cards;
+            current_winner = i;
+        }
+    }
+
+    PlayerWinner = current_winner;
+}
+
+Domino2D* DominoGameStructure::GetPlayerSelectedCard(uint16_t player_number)
+{
+    return Players[player_number].GetClickedCard();
+}
+
+bool DominoGameStructure::RenderPlayerDominoes()
+{
+    return Players[0].RenderPlayerDominoes();
+}
+
+void DominoGameStructure::ClearPlayerDominoes()
+{
+    for (auto& P : Players) {
+        P.ClearDominoes();
+    }
+}
+
+void DominoGameStructure::TurnAdvance()
+{
+    NumberOfTurns++;
+    CurrentTurn++;
+    if (CurrentTurn == NumberOfPlayers){
+        CurrentTurn = 0;
+    }
+    StateVersion++;
+}
+
+bool DominoGameStructure::CurrentPlayerCanAttack()
+{
+    return !GetLegalMoves()[0].IsPass();
+}
+
+void DominoGameStructure::AddBoardDominoes(Domino2D& D, int left_or_right)
+{
+    // If it's empty, then it's the first turn of the game, then set the domino for first domino placement
+    if (NoDominoesYet()) {
+        D.SetAsFirstDomino();
+        AddFirstDomino(D);
+    }
+    else if (left_or_right == TileDropPosition_Left) {
+        AddLeftDomino(D);
+    }
+    else if (left_or_right == TileDropPosition_Right) {
+        AddRightDomino(D);
+    }
+
+    TileOwner[dengine::TileIndex(D.GetLeftNumber(), D.GetRightNumber())] = TileOwner_Board;
+
+    // Log the current move
+    this->AddGameLogs(&D, CurrentTurn + 1, LogMove_TurnAttack, left_or_right);
+    // Because there is an added domino on board, then the number of passes shall reset
+    NumberOfPasses = 0;
+    StateVersion++;
+}
+
+uint16_t DominoGameStructure::GetWinnerNumber() const
+{
+    return PlayerWinner + 1;
+}
+
+void DominoGameStructure::ResetGameState()
+{
+    // Clear the board dominoes
+    this->ClearBoardDominoes();
+    // Clear the players' dominoes
+    this->ClearPlayerDominoes();
+    // Clear game logs
+    this->ClearGameLogs();
+    // Reset dominoes states
+    ResetGameDominoes();
+    NumberOfTurns  = 0;
+    NumberOfCards  = 0;
+    NumberOfPasses = 0;
+    TileOwner.fill(TileOwner_None);
+    StateVersion++;
+}
+
+uint16_t DominoGameStructure::GetNumberOfPlayers() const
+{
+    return NumberOfPlayers;
+}
+
+bool DominoGameStructure::AIAttackFunc()
+{
+    if (!NoDominoesYet() && !this->CurrentPlayerCanAttack()) {
+        return false;
+    }
+
+    const auto& ai_num = CurrentTurn;
+    AIPlayerLogic.SetAIData(&this->GetPlayerData(0), &this->GetPlayerData(ai_num));
+    AIPlayerLogic.AIAttack();
+    return true;
+}
+
+void DominoGameStructure::StartAIPondering(bool hints)
+{
+    AIPlayerLogic.StartPondering(hints);
+}
+
+void DominoGameStructure::StopAIPondering()
+{
+    AIPlayerLogic.StopPondering();
+}
+
+uint16_t DominoGameStructure::GetAIHints(std::array<RootMove, dengine::MaxMoves>& hints) const
+{
+    return AIPlayerLogic.GetHints(hints);
+}
+
+bool DominoGameStructure::StartAIThinking(float budget)
+{
+    if (!NoDominoesYet() && !this->CurrentPlayerCanAttack()) {
+        return false;
+    }
+
+    AIPlayerLogic.SetAIData(&this->GetPlayerData(0), &this->GetPlayerData(CurrentTurn));
+    return AIPlayerLogic.StartThinking(budget);
+}
+
+bool DominoGameStructure::IsAIThinking() const
+{
+    return AIPlayerLogic.IsThinking();
+}
+
+void DominoGameStructure::AddGameLogs(const Domino2D* d, uint16_t player_number, LogMove player_move, int side)
+{
+    const DominoMove engine_move = d == nullptr ? DominoMove() : DominoMove(dengine::TileIndex(d->GetLeftNumber(), d->GetRightNumber()), static_cast<uint8_t>(side));
+    GameLog.AddLog(d, player_number, player_move, engine_move);
+}
+
+const DominoLogs& DominoGameStructure::GetGameLogs() const
+{
+    return GameLog;
+}
+
+void DominoGameStructure::ClearGameLogs()
+{
+    GameLog.ClearLog();
+}
+
+void DominoGameStructure::RenderGameLogs(const GameReview* review)
+{
+    GameLog.RenderLog(-1, review);
+}
+
+void DominoGameStructure::RenderCurrentTurnLog()
+{
+    if (NumberOfTurns == 0) {
+        ImGui::Text("NO MOVES YET");
+        return;
+    }
+
+    GameLog.RenderLog(NumberOfTurns - 1);
+}
+
+uint16_t DominoGameStructure::GetNumberOfTurns() const
+{
+    return NumberOfTurns;
+}
+
+uint32_t DominoGameStructure::GetDealSeed() const
+{
+    return DealSeed;
+}
+
+uint8_t DominoGameStructure::GetTileOwner(const DominoTile& tile) const
+{
+    return TileOwner[dengine::TileIndex(tile.GetLeftNumber(), tile.GetRightNumber())];
+}
+
+void DominoGameStructure::ExportStartState(DominoEngine& engine)
+{
+    engine.ClearPosition(NumberOfPlayers);
+
+    std::array<uint8_t, dengine::NumberOfTiles> owner = TileOwner;
+    for (size_t log = 0; log < GameLog.GetNumberOfLogs(); log++) {
+        const DominoMove move = GameLog.GetEngineMove(log);
+        if (!move.IsPass()) {
+            owner[move.Tile] = static_cast<uint8_t>(GameLog.GetPlayerNumber(log) - 1);
+        }
+    }
+    for (uint8_t tile = 0; tile < dengine::NumberOfTiles; tile++) {
+        if (owner[tile] < NumberOfPlayers) {
+            engine.GiveTile(owner[tile], tile);
+        }
+    }
+
+    if (ChangeInPlayers) {
+        engine.SetRequiredTile(dengine::TileIndex(FirstTurnTileAttack.GetLeftNumber(), FirstTurnTileAttack.GetRightNumber()));
+    }
+    engine.SetTurns(FirstTurn, FirstTurn, 0);
+    engine.SetNumberOfPasses(0);
+}
+
+void DominoGameStructure::ExportEngineState(DominoEngine& engine)
+{
+    engine.ClearPosition(NumberOfPlayers);
+
+    for (uint8_t tile = 0; tile < dengine::NumberOfTiles; tile++) {
+        if (TileOwner[tile] == TileOwner_Board) {
+            engine.SetPlayedTile(tile);
+        }
+        else if (TileOwner[tile] != TileOwner_None) {
+            engine.GiveTile(TileOwner[tile], tile);
+        }
+    }
+
+    if (!NoDominoesYet()) {
+        const auto* left_domino  = EmptyLeftSideDominoes()  ? GetFirstDomino() : GetLatestLeftSideDomino();
+        const auto* right_domino = EmptyRightSideDominoes() ? GetFirstDomino() : GetLatestRightSideDomino();
+        engine.SetBoardEnds(static_cast<uint8_t>(left_domino->GetSideNumber(TileDropPosition_Left)), static_cast<uint8_t>(right_domino->GetSideNumber(TileDropPosition_Right)));
+    }
+    else if (ChangeInPlayers && NumberOfTurns == 0) {
+        engine.SetRequiredTile(dengine::TileIndex(FirstTurnTileAttack.GetLeftNumber(), FirstTurnTileAttack.GetRightNumber()));
+    }
+
+    engine.SetTurns(CurrentTurn, FirstTurn, NumberOfTurns);
+    engine.SetNumberOfPasses(NumberOfPasses);
+}
+
+void DominoGameStructure::UpdateTurnCache()
+{
+    if (CacheVersion == StateVersion) {
+        return;
+    }
+    ExportEngineState(CachedEngine);
+    CachedEngine.GenerateMoves(CachedMoves);
+    CacheVersion = StateVersion;
+}
+
+const DominoEngine& DominoGameStructure::GetEngineState()
+{
+    UpdateTurnCache();
+    return CachedEngine;
+}
+
+const DominoMoveList& DominoGameStructure::GetLegalMoves()
+{
+    UpdateTurnCache();
+    return CachedMoves;
+}
+
+bool DominoGameStructure::IsLegalMove(const DominoMove& move)
+{
+    const auto& moves = GetLegalMoves();
+    return std::find(moves.begin(), moves.end(), move) != moves.end();
+}
+
+uint32_t DominoGameStructure::GetStateVersion() const
+{
+    return StateVersion;
+}
+
+bool DominoGameStructure::GetForcedMove(DominoMove& move)
+{
+    return GetEngineState().GetForcedMove(move);
+}
+
+bool DominoGameStructure::AttackWithMove(const DominoMove& move)
+{
+    if (move.IsPass()) {
+        return false;
+    }
+
+    for (auto card : Players[CurrentTurn].GetPlayerCards()) {
+        if (card->IsRemoved() || dengine::TileIndex(card->GetLeftNumber(), card->GetRightNumber()) != move.Tile) {
+            continue;
+        }
+        if (NoDominoesYet()) {
+            card->SetAsFirstDomino();
+            AddBoardDominoes(*card, TileDropPosition_Left);
+            return true;
+        }
+        if (move.Side == EngineSide_Left) {
+            if (!card->ConnectDomino(EmptyLeftSideDominoes() ? *GetFirstDomino() : *GetLatestLeftSideDomino(), TileDropPosition_Left)) {
+                return false;
+            }
+            AddBoardDominoes(*card, TileDropPosition_Left);
+            return true;
+        }
+        if (!card->ConnectDomino(EmptyRightSideDominoes() ? *GetFirstDomino() : *GetLatestRightSideDomino(), TileDropPosition_Right)) {
+            return false;
+        }
+        AddBoardDominoes(*card, TileDropPosition_Right);
+        return true;
+    }
+
+    return false;
+}
+
+
+
+
+
+
+
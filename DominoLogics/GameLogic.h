@@ -1,381 +1,603 @@
-#pragma once
-
-#include "imgui.h"
-#include <vector>
-#include <random>
-#include <chrono>
-#include <array>
-
-enum AIDifficulty_
-{
-	AIDifficulty_Random,
-	AIDifficulty_Normal,
-	AIDifficulty_Hard,
-	AIDifficulty_GigaBrain
-};
-
-enum TileOrientation_
-{
-	TileOrientation_Horizontal = 0,
-	TileOrientation_Vertical   = 1
-};
-
-enum TileDropPosition_
-{
-	TileDropPosition_Left  = 0,
-	TileDropPosition_LeftDown = 2,
-	TileDropPosition_Up    = 0, // The same as the left number
-	TileDropPosition_Right = 1,
-	TileDropPosition_RightDown = 3,
-	TileDropPosition_Down  = 1  // The same as the right number
-};
-
-//-----------------------------------------------------------------------------------------------------------------------
-// DominoTile CLASS
-//-----------------------------------------------------------------------------------------------------------------------
-
-class DominoTile
-{
-protected:
-	bool     removed;
-	uint16_t left_number;
-	uint16_t right_number;
-
-public:
-	DominoTile() = default;
-	constexpr DominoTile(uint16_t num1, uint16_t num2);
-
-	constexpr bool     IsDoubleNumber() const;
-	constexpr bool     IsRemoved() const;
-	constexpr uint16_t TileSum();
-	constexpr uint16_t GetLeftNumber() const;
-	constexpr uint16_t GetRightNumber() const;
-
-	// Change the card status of whether it's already removed from the player's hand or not
-	void ChangeCardRemoveState(bool r);
-	
-};
-
-template<size_t S>
-using DominoTileArr        = std::array<DominoTile, S>;
-using DominoTileVec        = std::vector<DominoTile>;
-using DominoTileVecPointer = std::vector<DominoTile*>;
-
-
-
-//-----------------------------------------------------------------------------------------------------------------------
-// Domino2D CLASS
-//-----------------------------------------------------------------------------------------------------------------------
-
-class Domino2D : public DominoTile
-{
-protected:
-	// Static members
-	inline static float  TileHeight;
-	inline static float  TileWidth;
-	inline static float  TileScale;
-	inline static float  TileLeftWidth;
-	inline static ImVec2 TileVecSize;
-	inline static ImU32  TileColor;
-	inline static ImU32  DotColor;
-
-private:
-	// Non-static members
-	ImVec2   TilePos;
-	bool     MirrorTile;
-	int      TileOrientation;
-	bool     left_connectable;
-	bool     right_connectable;
-
-	bool TileButton(const char* label, bool OverrideMirror, ImGuiButtonFlags flags = 0) const;
-	bool ConnectDominoOnRight(Domino2D& d);
-	bool ConnectDominoOnLeft(Domino2D& d);
-
-public:
-	Domino2D() = default;
-	Domino2D(uint16_t leftnumber, uint16_t rightnumber);
-	~Domino2D() = default;
-
-	// Static Functions
-	static void    InitiateDominoStatics(float tile_h, ImU32 tile_col, ImU32 dot_col);
-	static void    InitiateDominoStatics(float tile_h, const ImVec4& tile_col, const ImVec4& dot_col);
-	static void    ChangeColors(ImU32 tile_col, ImU32 dot_col);
-	static void    ChangeColors(const ImVec4& tile_col, const ImVec4& dot_col);
-	static void    ChangeSize(float tile_h);
-	static ImU32&  GetTileColor();
-	static ImU32&  GetDotColor();
-	static ImVec2& GetDimensions();
-
-	// Non-static Functions
-	void CreateTile(uint16_t leftnumber, uint16_t rightnumber);
-	void ChangePosition(float plus_x, float plus_y);
-	ImVec2 GetPos() const;
-	uint16_t GetTileNumber() const;
-
-	// Set the domino parameters as the first domino [Centered, Horizontal(if not double number) or Vertical(if double number)]
-	bool SetAsFirstDomino();
-	// Connect the domino to a connectee domino depending on what tile number position (left or right)
-	bool ConnectDomino(Domino2D& DominoConnectee, int pos);
-	// Test the domino if it will connect with the connectee. Returns true if it connects for anyway it can
-	bool PseudoConnectDomino(Domino2D& DominoConnectee) const;
-	// Query if the left side of the tile is connectable
-	bool IsLeftConnectable() const;
-	// Query if the right side of the tile is connectable
-	bool IsRightConnectable() const;
-	// Change the card status of whether the left side of the tile is connectable or not
-	void ChangeLeftNumConnection(bool connectable);
-	// Change the card status of whether the right side of the tile is connectable or not
-	void ChangeRightNumConnection(bool connectable);
-	// Reset the parameters of the domino
-	void ResetParameters();
-
-	// Renders the tile textures and dots and all it needs to become a domino
-	bool RenderTile(const char* label, bool OverrideMirror, ImGuiButtonFlags flags = 0) const;
-	// Renders the tile as a drop option (a bit transparent version of the normal domino) 
-	bool RenderTransparentTile(const char* label, bool OverrideMirror, ImGuiButtonFlags flags = 0) const;
-	// Render the tile independently
-	bool RenderTileIndependently(const char* label, const ImVec2& sz, const ImVec2& position, ImGuiButtonFlags flags = 0) const;
-
-	constexpr bool operator == (const Domino2D& other) const;
-	constexpr bool operator == (const DominoTile& other) const;
-};
-
-
-//-----------------------------------------------------------------------------------------------------------------------
-// Player CLASS
-//-----------------------------------------------------------------------------------------------------------------------
-
-class Player
-{
-protected:
-	uint16_t               PlayerNumber;
-	Domino2D*              CurrentlyClickedCard = nullptr; // The card that is about to be used
-	std::vector<Domino2D*> PlayerCards;
-
-public:
-	Player() = default;
-	Player(const uint16_t& p_num);
-	uint16_t GetPlayerNum() const;
-
-	bool HasTheDouble(uint16_t num) const;
-	bool HasTheHighestCard(uint16_t num1, uint16_t num2) const;
-	void SetClickedCard(Domino2D* dcard);
-	void ClearCards();
-	void SetPlayerNum(uint16_t p_num);
-	void SetCard(Domino2D& card);
-	uint16_t SumOfCards() const;
-	uint16_t NumberOfCards() const;
-	Domino2D* GetClickedCard();
-	std::vector<Domino2D*>& GetPlayerCards();
-	uint16_t GetRemainingCards();
-
-};
-
-//-----------------------------------------------------------------------------------------------------------------------
-// PlayerDomino2D CLASS
-//-----------------------------------------------------------------------------------------------------------------------
-
-class PlayerDomino2D : public Player
-{
-private:
-	inline static ImU32* TileColor;
-	inline static ImU32* DotColor;
-	inline static ImU32  ClickedColor;
-	inline static ImVec2 TileSize;
-	inline static float  scale;
-	inline static float  HalfWidth;
-	inline static ImVec2 TilePositioning;
-
-public:
-	PlayerDomino2D() {}
-	PlayerDomino2D(uint16_t player_number);
-
-	static void InitializeDominoParameters();
-	void ClearDominoes();
-	bool InitializePlayerDomino();
-	bool RenderPlayerDominoes();
-
-	// DEBUG
-	void ChangeTilePositioning(float _x, float _y);
-	ImVec2 GetTilePosition();
-
-private:
-	bool PlayerDominoButton(Domino2D& DT, const char* label, const ImVec2& position, ImGuiButtonFlags flags = 0);
-
-};
-
-template<size_t S>
-using PlayerArr = std::array<PlayerDomino2D, S>;
-using PlayerVec = std::vector<PlayerDomino2D>;
-
-
-
-class GameBoardDominoes
-{
-protected:
-	Domino2D* FirstDomino = nullptr;           // The starting domino
-	std::vector<Domino2D*> LeftSideDominoes;   // The connecting dominoes from the left of FirstDomino
-	std::vector<Domino2D*> RightSideDominoes;  // The connecting dominoes from the right of FirstDomino
-
-	void AddFirstDomino(Domino2D& d);
-	void AddLeftDomino(Domino2D& d);
-	void AddRightDomino(Domino2D& d);
-	void ClearBoardDominoes();
-
-public:
-	bool      NoDominoesYet()          const ;
-	bool      EmptyLeftSideDominoes()  const ;
-	bool      EmptyRightSideDominoes() const ;
-	void      RenderBoardDominoes();
-	size_t    LeftSideSize() const ;
-	size_t    RightSideSize() const ;
-	Domino2D* GetFirstDomino();
-	Domino2D* GetLatestLeftSideDomino();
-	Domino2D* GetLatestRightSideDomino();
-
-};
-
-class DominoAI
-{
-private:
-	Player* PlayerData     = nullptr;   // Human player data
-	Player* AIData         = nullptr;   // AI data
-	int     AIDifficulty;
-
-public:
-	DominoAI() = default;
-	DominoAI(Player* p_data, Player* ai_data, uint16_t ai_difficulty);
-	~DominoAI() = default;
-
-	void SetAIData(Player* p_data, Player* ai_data);
-	void SetDifficulty(uint16_t ai_difficulty);
-	void AIAttack();
-
-private:
-	// Will randomize the order of cards and use the foremost usable card to attack from left to right
-	void RandomCompute();
-	void NormalCompute();
-	void HardCompute();
-	void GigaBrainCompute();
-	bool FirstTurnAIAttack();
-
-};
-
-
-
-//-----------------------------------------------------------------------------------------------------------------------
-// DominoLogs CLASS
-//-----------------------------------------------------------------------------------------------------------------------
-enum LogMove_
-{
-	LogMove_TurnPassed,
-	LogMove_TurnAttack
-};
-using LogMove = uint16_t;
-
-class DominoLogs
-{
-private:
-	struct AttackLog
-	{
-		const Domino2D* DominoUsed = nullptr;
-		uint16_t PlayerNumber;
-		LogMove PlayerMove;
-
-		AttackLog() = default;
-		AttackLog(const Domino2D* d, uint16_t player_number, LogMove player_move) :
-			DominoUsed(d), PlayerNumber(player_number), PlayerMove(player_move)
-		{}
-	};
-	std::vector<AttackLog> LogData;
-
-public:
-	DominoLogs() = default;
-
-	void AddLog(const Domino2D* d, uint16_t player_number, LogMove player_move);
-	void ClearLog();
-	void RenderLog(int CurrentTurn = -1);
-
-};
-
-
-// Domino Game State
-class DominoGameStructure : public GameBoardDominoes
-{
-private:
-	bool              GameInitialized;
-	bool              ChangeInPlayers;
-	bool              PlayerOneAlwaysFirst;
-	DominoLogs        GameLog;
-	DominoAI          AIPlayerLogic;
-	PlayerArr<8>      Players;
-	uint16_t          CurrentTurn;
-	uint16_t          NumberOfTurns;
-	uint16_t          NumberOfCards;
-	uint16_t          NumberOfPlayers;
-	uint16_t          PlayerWinner;
-	uint16_t          FirstTurn;
-	uint16_t          LastTurn;
-	uint16_t          NumberOfPasses;
-	DominoTile        FirstTurnTileAttack;       // This should be the tile that can only be used by the first turn player
-
-public:
-	DominoGameStructure();
-	~DominoGameStructure() = default;
-	
-	bool            InitializeGame(const uint16_t& number_of_players, const uint16_t& ai_difficulty, const bool& change_player = false);
-	bool            CheckGameState();
-	void            SetNoClickedCard();
-	uint16_t        GetWinnerNumber() const;
-	uint16_t        GetCurrentTurn() const;
-	Domino2D*       GetPlayerSelectedCard(uint16_t player_number);
-	PlayerDomino2D& GetPlayerData(uint16_t pnum);
-
-	bool       CurrentPlayerCanAttack();
-	bool       IsThereAChangeInPlayer();
-	void       PassCurrentTurn();
-	void       TurnAdvance();
-	void       ResetGameState();
-	bool       RenderPlayerDominoes();
-	void       AddBoardDominoes(Domino2D& D, int left_or_right);
-	bool       AIAttackFunc();
-	void       AddGameLogs(const Domino2D* d, uint16_t player_number, LogMove player_move);
-	void       RenderGameLogs();
-	void       RenderCurrentTurnLog();
-	void       SetPlayerOneAsFirstTurn(bool enable);
-	uint16_t   GetNumberOfPlayers() const;
-	uint16_t   GetNumberOfTurns() const;
-	DominoTile GetFirstTurnTile() const;
-
-private:
-	// For distributing cards to the players
-	void DistributeCards();
-	// For finding the first player turn
-	void FindFirstPlayerTurn();
-	// For finding the winner in a stalemate by finding the lowest sum of all cards of a player
-	void FindTheLowestSum();
-	// Clear player dominoes
-	void ClearPlayerDominoes();
-	// Clear the game logs
-	void ClearGameLogs();
-};
-
-// Global Domino Variables
-namespace dvars
-{
-// The game's dominoes. 27 dominoes in total
-inline std::array<Domino2D, 27> GameDominoes = { 
-												  Domino2D(1, 0), Domino2D(2, 0), Domino2D(3, 0), Domino2D(4, 0), Domino2D(5, 0), Domino2D(6, 0),
-												  Domino2D(1, 1), Domino2D(2, 1), Domino2D(3, 1), Domino2D(4, 1), Domino2D(5, 1), Domino2D(6, 1),
-												  Domino2D(2, 2), Domino2D(3, 2), Domino2D(4, 2), Domino2D(5, 2), Domino2D(6, 2),
-												  Domino2D(3, 3), Domino2D(4, 3), Domino2D(5, 3), Domino2D(6, 3),
-												  Domino2D(4, 4), Domino2D(5, 4), Domino2D(6, 4),
-												  Domino2D(5, 5), Domino2D(6, 5),
-												  Domino2D(6, 6)
-												};
-
-inline DominoGameStructure GameState;
-
-}
-
-
+#pragma once
+
+#include "imgui.h"
+#include "DominoEngine.h"
+#include "DominoEvaluator.h"
+#include "DominoSearch.h"
+#include <algorithm>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <array>
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+
+enum TileOrientation_
+{
+	TileOrientation_Horizontal = 0,
+	TileOrientation_Vertical   = 1
+};
+
+enum TileDropPosition_
+{
+	TileDropPosition_Left  = 0,
+	TileDropPosition_LeftDown = 2,
+	TileDropPosition_Up    = 0, // The same as the left number
+	TileDropPosition_Right = 1,
+	TileDropPosition_RightDown = 3,
+	TileDropPosition_Down  = 1  // The same as the right number
+};
+
+// Entries of the tile owner index besides the player numbers
+enum TileOwner_
+{
+	TileOwner_Board = 0xFE, // Already played
+	TileOwner_None  = 0xFF  // Not dealt
+};
+
+//-----------------------------------------------------------------------------------------------------------------------
+// DominoTile CLASS
+//-----------------------------------------------------------------------------------------------------------------------
+
+class DominoTile
+{
+protected:
+	bool     removed;
+	uint16_t left_number;
+	uint16_t right_number;
+
+public:
+	DominoTile() = default;
+	constexpr DominoTile(uint16_t num1, uint16_t num2);
+
+	constexpr bool     IsDoubleNumber() const;
+	constexpr bool     IsRemoved() const;
+	constexpr uint16_t TileSum();
+	constexpr uint16_t GetLeftNumber() const;
+	constexpr uint16_t GetRightNumber() const;
+
+	// Change the card status of whether it's already removed from the player's hand or not
+	void ChangeCardRemoveState(bool r);
+	
+};
+
+template<size_t S>
+using DominoTileArr        = std::array<DominoTile, S>;
+using DominoTileVec        = std::vector<DominoTile>;
+using DominoTileVecPointer = std::vector<DominoTile*>;
+
+
+
+//-----------------------------------------------------------------------------------------------------------------------
+// Domino2D CLASS
+//-----------------------------------------------------------------------------------------------------------------------
+
+class Domino2D : public DominoTile
+{
+protected:
+	// Static members
+	inline static float  TileHeight;
+	inline static float  TileWidth;
+	inline static float  TileScale;
+	inline static float  TileLeftWidth;
+	inline static ImVec2 TileVecSize;
+	inline static ImU32  TileColor;
+	inline static ImU32  DotColor;
+
+private:
+	// Non-static members
+	ImVec2   TilePos;
+	bool     MirrorTile;
+	int      TileOrientation;
+	bool     left_connectable;
+	bool     right_connectable;
+
+	bool TileButton(const char* label, bool OverrideMirror, ImGuiButtonFlags flags = 0) const;
+	bool ConnectDominoOnRight(Domino2D& d);
+	bool ConnectDominoOnLeft(Domino2D& d);
+
+public:
+	Domino2D() = default;
+	Domino2D(uint16_t leftnumber, uint16_t rightnumber);
+	~Domino2D() = default;
+
+	// Static Functions
+	static void    InitiateDominoStatics(float tile_h, ImU32 tile_col, ImU32 dot_col);
+	static void    InitiateDominoStatics(float tile_h, const ImVec4& tile_col, const ImVec4& dot_col);
+	static void    ChangeColors(ImU32 tile_col, ImU32 dot_col);
+	static void    ChangeColors(const ImVec4& tile_col, const ImVec4& dot_col);
+	static void    ChangeSize(float tile_h);
+	static ImU32&  GetTileColor();
+	static ImU32&  GetDotColor();
+	static ImVec2& GetDimensions();
+
+	// Non-static Functions
+	void CreateTile(uint16_t leftnumber, uint16_t rightnumber);
+	void ChangePosition(float plus_x, float plus_y);
+	ImVec2 GetPos() const;
+	uint16_t GetTileNumber() const;
+	// Query the tile number facing the left (up) or right (down) side of the board, mirroring included
+	uint16_t GetSideNumber(int pos) const;
+
+	// Set the domino parameters as the first domino [Centered, Horizontal(if not double number) or Vertical(if double number)]
+	bool SetAsFirstDomino();
+	// Connect the domino to a connectee domino depending on what tile number position (left or right)
+	bool ConnectDomino(Domino2D& DominoConnectee, int pos);
+	// Test the domino if it will connect with the connectee. Returns true if it connects for anyway it can
+	bool PseudoConnectDomino(Domino2D& DominoConnectee) const;
+	// Query if the left side of the tile is connectable
+	bool IsLeftConnectable() const;
+	// Query if the right side of the tile is connectable
+	bool IsRightConnectable() const;
+	// Change the card status of whether the left side of the tile is connectable or not
+	void ChangeLeftNumConnection(bool connectable);
+	// Change the card status of whether the right side of the tile is connectable or not
+	void ChangeRightNumConnection(bool connectable);
+	// Reset the parameters of the domino
+	void ResetParameters();
+
+	// Renders the tile textures and dots and all it needs to become a domino
+	bool RenderTile(const char* label, bool OverrideMirror, ImGuiButtonFlags flags = 0) const;
+	// Renders the tile as a drop option (a bit transparent version of the normal domino) 
+	bool RenderTransparentTile(const char* label, bool OverrideMirror, ImGuiButtonFlags flags = 0) const;
+	// Render the tile independently
+	bool RenderTileIndependently(const char* label, const ImVec2& sz, const ImVec2& position, ImGuiButtonFlags flags = 0) const;
+
+	constexpr bool operator == (const Domino2D& other) const;
+	constexpr bool operator == (const DominoTile& other) const;
+};
+
+
+//-----------------------------------------------------------------------------------------------------------------------
+// Player CLASS
+//-----------------------------------------------------------------------------------------------------------------------
+
+class Player
+{
+protected:
+	uint16_t               PlayerNumber;
+	Domino2D*              CurrentlyClickedCard = nullptr; // The card that is about to be used
+	std::vector<Domino2D*> PlayerCards;
+
+public:
+	Player() = default;
+	Player(const uint16_t& p_num);
+	uint16_t GetPlayerNum() const;
+
+	void SetClickedCard(Domino2D* dcard);
+	void ClearCards();
+	void SetPlayerNum(uint16_t p_num);
+	void SetCard(Domino2D& card);
+	uint16_t SumOfCards() const;
+	uint16_t NumberOfCards() const;
+	Domino2D* GetClickedCard();
+	std::vector<Domino2D*>& GetPlayerCards();
+	uint16_t GetRemainingCards();
+
+};
+
+//-----------------------------------------------------------------------------------------------------------------------
+// PlayerDomino2D CLASS
+//-----------------------------------------------------------------------------------------------------------------------
+
+class PlayerDomino2D : public Player
+{
+private:
+	inline static ImU32* TileColor;
+	inline static ImU32* DotColor;
+	inline static ImU32  ClickedColor;
+	inline static ImVec2 TileSize;
+	inline static float  scale;
+	inline static float  HalfWidth;
+	inline static ImVec2 TilePositioning;
+
+public:
+	PlayerDomino2D() {}
+	PlayerDomino2D(uint16_t player_number);
+
+	static void InitializeDominoParameters();
+	void ClearDominoes();
+	bool InitializePlayerDomino();
+	bool RenderPlayerDominoes();
+
+	// DEBUG
+	void ChangeTilePositioning(float _x, float _y);
+	ImVec2 GetTilePosition();
+
+private:
+	bool PlayerDominoButton(Domino2D& DT, const char* label, const ImVec2& position, ImGuiButtonFlags flags = 0);
+
+};
+
+template<size_t S>
+using PlayerArr = std::array<PlayerDomino2D, S>;
+using PlayerVec = std::vector<PlayerDomino2D>;
+
+
+
+class GameBoardDominoes
+{
+protected:
+	Domino2D* FirstDomino = nullptr;           // The starting domino
+	std::vector<Domino2D*> LeftSideDominoes;   // The connecting dominoes from the left of FirstDomino
+	std::vector<Domino2D*> RightSideDominoes;  // The connecting dominoes from the right of FirstDomino
+
+	void AddFirstDomino(Domino2D& d);
+	void AddLeftDomino(Domino2D& d);
+	void AddRightDomino(Domino2D& d);
+	void ClearBoardDominoes();
+
+public:
+	bool      NoDominoesYet()          const ;
+	bool      EmptyLeftSideDominoes()  const ;
+	bool      EmptyRightSideDominoes() const ;
+	void      RenderBoardDominoes();
+	size_t    LeftSideSize() const ;
+	size_t    RightSideSize() const ;
+	Domino2D* GetFirstDomino();
+	Domino2D* GetLatestLeftSideDomino();
+	Domino2D* GetLatestRightSideDomino();
+
+};
+
+class DominoAI
+{
+private:
+	Player*         PlayerData     = nullptr;   // Human player data
+	Player*         AIData         = nullptr;   // AI data
+	int             AIDifficulty;
+	bool            WeightsLoaded  = false;     // Trained weights are loaded from domino_weights.txt if there is one
+	DominoEvaluator Evaluator;
+	// GigaBrain's search of every AI seat, kept across the seat's turns, and the number of logged moves it followed
+	std::vector<DominoSearch> SeatSearches;
+	std::vector<size_t>       SeatLogs;
+	// The thread that ponders and looks for hints while the human player thinks, and the game version it's at
+	std::thread               PonderThread;
+	std::atomic<bool>         PonderStop     = false;
+	uint32_t                  PonderVersion  = 0;
+	bool                      PonderHints    = false;
+	// The human player's moves ranked by the hint search so far, for the game version HintVersion
+	mutable std::mutex        HintMutex;
+	std::array<RootMove, dengine::MaxMoves> Hints;
+	uint16_t                  NumberOfHints  = 0;
+	uint32_t                  HintVersion    = UINT32_MAX;
+
+	// The thread works every other slice of PonderSlice iterations, so it takes at most half of a core. Pondering quits
+	// after PonderIterations, four moves' worth of GigaBrain iterations, and the hints after HintIterations
+	static constexpr uint32_t PonderSlice      = 256;
+	static constexpr uint32_t PonderIterations = 16000;
+	static constexpr uint32_t HintIterations   = 64000;
+	// The move Hard or GigaBrain thinks about on its own thread, the game version it's for and the clock of the move
+	std::thread               ThinkThread;
+	std::atomic<bool>         ThinkDone      = false;
+	DominoMove                ThinkMove;
+	uint32_t                  ThinkVersion   = 0;
+	TimeManager               ThinkTime;
+
+public:
+	DominoAI() = default;
+	DominoAI(Player* p_data, Player* ai_data, uint16_t ai_difficulty);
+	~DominoAI();
+
+	void SetAIData(Player* p_data, Player* ai_data);
+	void SetDifficulty(uint16_t ai_difficulty);
+	void AIAttack();
+	// GigaBrain thinks on the human player's turn: the AI seat that plays next grows its tree from the current position
+	// in the background. With hints, the same thread runs an Mcts for the human player too, with any AI, and the
+	// ranking of their moves gets better with every slice. It does nothing if the thread already did this position to
+	// the end or is still at it
+	void StartPondering(bool hints);
+	// Waits for the pondering thread. The tree is kept, and the seat's next move goes on from it if the human's move
+	// is in it
+	void StopPondering();
+	// Hard and GigaBrain think about the current turn on a thread for about budget seconds, see TimeManager, and the
+	// next AIAttack plays the move they found. Returns false for the AIs that answer right away
+	bool StartThinking(float budget);
+	bool IsThinking() const;
+	// The human player's moves ranked by the hint search so far, best first. Returns how many, 0 until the search has
+	// something for the current position
+	uint16_t GetHints(std::array<RootMove, dengine::MaxMoves>& hints) const;
+
+private:
+	// Will randomize the order of cards and use the foremost usable card to attack from left to right
+	void RandomCompute();
+	void NormalCompute();
+	void HardCompute();
+	void GigaBrainCompute();
+	bool FirstTurnAIAttack();
+	// The search of the seat, moved along the logged moves it hasn't followed yet
+	DominoSearch& SeatSearch(uint16_t seat);
+	// The searches of Hard and GigaBrain. With a clock they run until it says so instead of to their default limits
+	DominoMove    HardMove(const DominoEngine& engine, const TimeManager* time);
+	DominoMove    GigaBrainMove(DominoSearch& search, const DominoEngine& engine, const TimeManager* time);
+	// Plays the move of the last thinking if it's for the current game version
+	bool          PlayThoughtMove();
+	// Cuts the thinking short and forgets its move, when the game is restarted or closed
+	void          EndThinking();
+
+};
+
+
+
+//-----------------------------------------------------------------------------------------------------------------------
+// WinMeter CLASS
+//-----------------------------------------------------------------------------------------------------------------------
+
+// Every player's chance to win as the human player sees it, from rollouts that run on a background thread for as long
+// as the game goes on. Every rollout deals the hidden hands again and plays the game out with the evaluator. When the
+// position changes the old rollouts are kept with a quarter of their weight, so the estimate moves on from the last one
+// instead of starting over. The thread works CpuShare of the time and rests once a position has MaxRollouts
+class WinMeter
+{
+private:
+	std::thread             Thread;
+	mutable std::mutex      Mutex;
+	std::condition_variable Wake;
+	bool                    Quit            = false;
+	float                   CpuShare        = 0.25f;
+	DominoEngine            Position;
+	uint32_t                PositionVersion = UINT32_MAX;
+	std::array<float, dengine::MaxPlayers> Wins{};
+	float                   Rollouts        = 0.0f;   // Weighted by how many moves ago they were made
+	DominoEvaluator         Evaluator;
+
+	static constexpr float    Decay        = 0.25f;
+	static constexpr float    MaxRollouts  = 20000.0f;
+	static constexpr uint32_t RolloutBatch = 32;
+	static constexpr float    Explore      = 0.1f;
+
+public:
+	WinMeter() = default;
+	~WinMeter();
+
+	// The share of a core the rollouts take, 0 stops them
+	void  SetCpuShare(float share);
+	float GetCpuShare() const;
+	// The position of the game and its DominoGameStructure::GetStateVersion, cheap enough for every frame. Never waits
+	// for the thread, a change it can't hand over right away is handed over on a later call
+	void  Update(const DominoEngine& engine, uint32_t version);
+	// The chance of every player to win and the weight of the rollouts behind it, 0 while there are none. Returns false
+	// without waiting when the thread is handing its results over
+	bool  GetWinProbabilities(std::array<float, dengine::MaxPlayers>& probabilities, float& rollouts) const;
+
+private:
+	void  RolloutLoop();
+};
+
+
+
+//-----------------------------------------------------------------------------------------------------------------------
+// GameReview CLASS
+//-----------------------------------------------------------------------------------------------------------------------
+enum ReviewVerdict_
+{
+	ReviewVerdict_Pending,
+	ReviewVerdict_Forced,      // Nothing to choose from
+	ReviewVerdict_Good,
+	ReviewVerdict_Blunder,     // ReviewBlunder or more below the best move's chance to win
+	ReviewVerdict_MissedWin    // The best move was all but a sure win and the one played wasn't
+};
+using ReviewVerdict = uint8_t;
+
+struct MoveReview
+{
+	std::atomic<ReviewVerdict> Verdict     = ReviewVerdict_Pending;   // Set last, the rest is only read after it
+	DominoMove                 Best;
+	float                      BestValue   = 0.0f;
+	float                      PlayedValue = 0.0f;
+};
+
+class DominoLogs;
+
+// The moves of a finished game searched again by Mcts, from what the player knew when they played them. Every logged
+// move is a task, and a worker per core takes the next one until they're all done. The reviews are published one by
+// one as they finish, without locks, so the log view shows them while the rest are still being searched
+class GameReview
+{
+private:
+	std::vector<std::thread>  Workers;
+	std::vector<DominoEngine> Positions;       // The position before every logged move
+	std::vector<DominoMove>   Played;
+	std::vector<MoveReview>   Reviews;
+	std::atomic<size_t>       NextTask = 0;
+	std::atomic<size_t>       Finished = 0;
+	std::atomic<bool>         Stop     = false;
+	bool                      WeightsLoaded = false;
+	DominoEvaluator           Evaluator;
+
+	static constexpr uint32_t ReviewIterations = 20000;   // Five GigaBrain moves
+	static constexpr float    ReviewBlunder    = 0.15f;
+	static constexpr float    ReviewSureWin    = 0.9f;
+
+public:
+	GameReview() = default;
+	~GameReview();
+
+	// Searches the logged moves again from the game's starting position, see DominoGameStructure::ExportStartState.
+	// Returns false if the logs don't replay from it
+	bool   Start(const DominoEngine& start, const DominoLogs& logs);
+	// Stops the workers and forgets the reviews
+	void   Cancel();
+	size_t GetNumberOfMoves() const;
+	size_t GetNumberOfFinished() const;
+	// The review of a logged move, Pending until it's done
+	const MoveReview* GetReview(size_t log) const;
+
+private:
+	void   ReviewLoop();
+	void   ReviewMove(size_t log, DominoSearch& search, std::mt19937& rng);
+};
+
+
+
+//-----------------------------------------------------------------------------------------------------------------------
+// DominoLogs CLASS
+//-----------------------------------------------------------------------------------------------------------------------
+enum LogMove_
+{
+	LogMove_TurnPassed,
+	LogMove_TurnAttack
+};
+using LogMove = uint16_t;
+
+class DominoLogs
+{
+private:
+	struct AttackLog
+	{
+		const Domino2D* DominoUsed = nullptr;
+		uint16_t PlayerNumber;
+		LogMove PlayerMove;
+		DominoMove EngineMove;   // The same move on the engine
+
+		AttackLog() = default;
+		AttackLog(const Domino2D* d, uint16_t player_number, LogMove player_move, const DominoMove& engine_move) :
+			DominoUsed(d), PlayerNumber(player_number), PlayerMove(player_move), EngineMove(engine_move)
+		{}
+	};
+	std::vector<AttackLog> LogData;
+
+public:
+	DominoLogs() = default;
+
+	void AddLog(const Domino2D* d, uint16_t player_number, LogMove player_move, const DominoMove& engine_move);
+	void ClearLog();
+	size_t     GetNumberOfLogs() const;
+	DominoMove GetEngineMove(size_t log) const;
+	// Counted from 1 like the UI
+	uint16_t   GetPlayerNumber(size_t log) const;
+	// With a review, every move of the full log shows its verdict once it's done
+	void RenderLog(int CurrentTurn = -1, const GameReview* review = nullptr);
+
+private:
+	static void RenderMoveReview(const MoveReview& review);
+
+};
+
+
+// Domino Game State
+class DominoGameStructure : public GameBoardDominoes
+{
+private:
+	bool              GameInitialized;
+	bool              ChangeInPlayers;
+	bool              PlayerOneAlwaysFirst;
+	DominoLogs        GameLog;
+	DominoAI          AIPlayerLogic;
+	PlayerArr<8>      Players;
+	uint16_t          CurrentTurn;
+	uint16_t          NumberOfTurns;
+	uint16_t          NumberOfCards;
+	uint16_t          NumberOfPlayers;
+	uint16_t          PlayerWinner;
+	uint16_t          FirstTurn;
+	uint16_t          LastTurn;
+	uint16_t          NumberOfPasses;
+	uint32_t          DealSeed;                  // The seed of the deal. The tools replay the same deal with DominoEngine::NewGame
+	DominoTile        FirstTurnTileAttack;       // This should be the tile that can only be used by the first turn player
+	std::array<uint8_t, dengine::NumberOfTiles> TileOwner;   // The player holding every tile by its engine index, or a TileOwner_ entry
+	uint32_t          StateVersion;              // Bumped on every change of the game, the turn cache is rebuilt when it lags behind
+	uint32_t          CacheVersion;
+	DominoEngine      CachedEngine;              // The game mirrored on the engine at CacheVersion
+	DominoMoveList    CachedMoves;               // Legal moves of the current turn player at CacheVersion
+
+public:
+	DominoGameStructure();
+	~DominoGameStructure() = default;
+	
+	bool            InitializeGame(const uint16_t& number_of_players, const uint16_t& ai_difficulty, const bool& change_player = false);
+	bool            CheckGameState();
+	void            SetNoClickedCard();
+	uint16_t        GetWinnerNumber() const;
+	uint16_t        GetCurrentTurn() const;
+	Domino2D*       GetPlayerSelectedCard(uint16_t player_number);
+	PlayerDomino2D& GetPlayerData(uint16_t pnum);
+
+	bool       CurrentPlayerCanAttack();
+	bool       IsThereAChangeInPlayer();
+	void       PassCurrentTurn();
+	void       TurnAdvance();
+	void       ResetGameState();
+	bool       RenderPlayerDominoes();
+	void       AddBoardDominoes(Domino2D& D, int left_or_right);
+	bool       AIAttackFunc();
+	// See DominoAI::StartPondering, DominoAI::StopPondering and DominoAI::GetHints
+	void       StartAIPondering(bool hints);
+	void       StopAIPondering();
+	uint16_t   GetAIHints(std::array<RootMove, dengine::MaxMoves>& hints) const;
+	// See DominoAI::StartThinking. AIAttackFunc plays the move once the thinking is over
+	bool       StartAIThinking(float budget);
+	bool       IsAIThinking() const;
+	// side is where the tile went, a TileDropPosition_ entry
+	void       AddGameLogs(const Domino2D* d, uint16_t player_number, LogMove player_move, int side = TileDropPosition_Left);
+	const DominoLogs& GetGameLogs() const;
+	void       RenderGameLogs(const GameReview* review = nullptr);
+	void       RenderCurrentTurnLog();
+	void       SetPlayerOneAsFirstTurn(bool enable);
+	uint16_t   GetNumberOfPlayers() const;
+	uint16_t   GetNumberOfTurns() const;
+	uint32_t   GetDealSeed() const;
+	// The player holding the tile, TileOwner_Board once it's played and TileOwner_None if it wasn't dealt
+	uint8_t    GetTileOwner(const DominoTile& tile) const;
+	DominoTile GetFirstTurnTile() const;
+	// Mirror the current game on a headless engine for the AI and simulations
+	void       ExportEngineState(DominoEngine& engine);
+	// The position the game started from: the hands of now with the tiles the logs say every player played
+	void       ExportStartState(DominoEngine& engine);
+	// The game mirrored on the engine and the current turn player's legal moves, computed once per change of the game
+	// and shared by the UI and the AI. The references stay valid until the next change
+	const DominoEngine&   GetEngineState();
+	const DominoMoveList& GetLegalMoves();
+	bool                  IsLegalMove(const DominoMove& move);
+	uint32_t              GetStateVersion() const;
+	// The only move of the current turn player, see DominoEngine::GetForcedMove. False if the player has a choice
+	bool       GetForcedMove(DominoMove& move);
+	// Attack with the engine move of the current turn player. Returns false if the player doesn't have the tile or it
+	// won't connect
+	bool       AttackWithMove(const DominoMove& move);
+
+private:
+	// For distributing cards to the players
+	void DistributeCards();
+	// For finding the first player turn
+	void FindFirstPlayerTurn();
+	// For finding the winner in a stalemate by finding the lowest sum of all cards of a player
+	void FindTheLowestSum();
+	// For ending a stalemate right away instead of after a round of passes
+	bool NobodyCanAttack();
+	// Mirror the game and generate the legal moves again if it changed since the last time
+	void UpdateTurnCache();
+	// Clear player dominoes
+	void ClearPlayerDominoes();
+	// Clear the game logs
+	void ClearGameLogs();
+};
+
+// Global Domino Variables
+namespace dvars
+{
+// The game's dominoes. 27 dominoes in total
+inline std::array<Domino2D, 27> GameDominoes = { 
+												  Domino2D(1, 0), Domino2D(2, 0), Domino2D(3, 0), Domino2D(4, 0), Domino2D(5, 0), Domino2D(6, 0),
+												  Domino2D(1, 1), Domino2D(2, 1), Domino2D(3, 1), Domino2D(4, 1), Domino2D(5, 1), Domino2D(6, 1),
+												  Domino2D(2, 2), Domino2D(3, 2), Domino2D(4, 2), Domino2D(5, 2), Domino2D(6, 2),
+												  Domino2D(3, 3), Domino2D(4, 3), Domino2D(5, 3), Domino2D(6, 3),
+												  Domino2D(4, 4), Domino2D(5, 4), Domino2D(6, 4),
+												  Domino2D(5, 5), Domino2D(6, 5),
+												  Domino2D(6, 6)
+												};
+
+inline DominoGameStructure GameState;
+
+// The transposition table of the Hard AI, shared by its search threads and kept from one move to the next
+inline TranspositionTable SearchTable(32 << 20);
+
+// The endgame tables of every number of players, mapped from Tablebase::DefaultPath when the first game with that many
+// players starts. Every search of the AIs probes the one of its game, the numbers of players without a file have none
+inline std::array<Tablebase, dengine::MaxPlayers + 1> EndgameTables;
+
+}
+
+
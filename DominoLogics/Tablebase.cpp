@@ -0,0 +1,587 @@
+#include "Tablebase.h"
+#include "DealIndex.h"
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+
+#ifdef _WIN32
+#define NOMINMAX
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace dengine;
+
+//-----------------------------------------------------------------------------------------------------------------------
+// Indexing
+//-----------------------------------------------------------------------------------------------------------------------
+
+namespace
+{
+constexpr TileMask AllTiles = (TileMask(1) << NumberOfTiles) - 1;
+
+constexpr std::array<std::array<uint32_t, NumberOfTiles + 1>, NumberOfTiles + 1> MakeBinomials()
+{
+    std::array<std::array<uint32_t, NumberOfTiles + 1>, NumberOfTiles + 1> table{};
+    for (int n = 0; n <= NumberOfTiles; n++) {
+        table[n][0] = 1;
+        for (int k = 1; k <= n; k++) {
+            table[n][k] = table[n - 1][k - 1] + (k < n ? table[n - 1][k] : 0);
+        }
+    }
+    return table;
+}
+
+constexpr auto Binomials = MakeBinomials();
+
+// deal_index::RankPartition of the hands in 64 bits, for the probes
+uint64_t RankHands(const TileMask* hands, uint16_t players)
+{
+    TileMask universe = AllTiles;
+    uint64_t index    = 0;
+    uint64_t radix    = 1;
+    for (uint16_t p = 0; p < players; p++) {
+        uint64_t rank = 0;
+        uint32_t k    = 0;
+        for (TileMask m = hands[p]; m; m &= m - 1) {
+            rank += Binomials[std::popcount(universe & ((m & (0 - m)) - 1))][++k];
+        }
+        index    += rank * radix;
+        radix    *= Binomials[std::popcount(universe)][k];
+        universe &= ~hands[p];
+    }
+    return index;
+}
+}
+
+uint16_t tablebase::GetHandSizes(const DominoEngine& engine, HandSizes& cards)
+{
+    const uint16_t players = engine.GetNumberOfPlayers();
+    const uint16_t mover   = engine.GetCurrentTurn();
+    uint16_t       tiles   = 0;
+    for (uint16_t p = 0; p < players; p++) {
+        cards[p] = static_cast<uint8_t>(std::popcount(engine.GetHand((mover + p) % players)));
+        tiles   += cards[p];
+    }
+    return tiles;
+}
+
+uint32_t tablebase::SectionKey(uint16_t players, const HandSizes& cards)
+{
+    const uint32_t radix = CardsPerPlayer(players) + 1;
+    uint32_t       key   = 0;
+    for (int p = players - 1; p >= 0; p--) {
+        if (cards[p] == 0 || cards[p] >= radix) {
+            return NoKey;
+        }
+        key = key * radix + cards[p];
+    }
+    return key;
+}
+
+uint32_t tablebase::NumberOfKeys(uint16_t players)
+{
+    uint32_t keys = 1;
+    for (uint16_t p = 0; p < players; p++) {
+        keys *= CardsPerPlayer(players) + 1;
+    }
+    return keys;
+}
+
+std::vector<tablebase::HandSizes> tablebase::Sections(uint16_t players, uint16_t max_tiles)
+{
+    std::vector<HandSizes> sections;
+    HandSizes              cards{};
+    std::fill(cards.begin(), cards.begin() + players, 1);
+    while (true) {
+        uint16_t tiles = 0;
+        for (uint16_t p = 0; p < players; p++) {
+            tiles += cards[p];
+        }
+        if (tiles <= max_tiles) {
+            sections.push_back(cards);
+        }
+
+        // Next hand sizes, the first hand counting fastest
+        uint16_t p = 0;
+        for (; p < players && cards[p] == CardsPerPlayer(players); p++) {
+            cards[p] = 1;
+        }
+        if (p == players) {
+            break;
+        }
+        cards[p]++;
+    }
+
+    std::stable_sort(sections.begin(), sections.end(), [players](const HandSizes& a, const HandSizes& b) {
+        int difference = 0;
+        for (uint16_t p = 0; p < players; p++) {
+            difference += a[p] - b[p];
+        }
+        return difference < 0;
+    });
+    return sections;
+}
+
+uint64_t tablebase::NumberOfPositions(uint16_t players, const HandSizes& cards)
+{
+    DealIndex count = deal_index::CountPartitions(cards.data(), players);
+    count.MultiplyAdd(players, 0);
+    count.MultiplyAdd(EndStates, 0);
+    return count.FitsIn64Bits() ? count.Low : 0;
+}
+
+uint64_t tablebase::IndexPosition(const DominoEngine& engine)
+{
+    const uint16_t players = engine.GetNumberOfPlayers();
+    const uint16_t mover   = engine.GetCurrentTurn();
+
+    std::array<TileMask, MaxPlayers> hands;
+    for (uint16_t p = 0; p < players; p++) {
+        hands[p] = engine.GetHand((mover + p) % players);
+    }
+
+    // The hands are the most significant digit, so the positions of the same hands are next to each other
+    uint64_t index = RankHands(hands.data(), players);
+    index = index * players + (engine.GetFirstTurn() + players - mover) % players;
+    index = index * EndStates + engine.GetLeftEnd() * (HighestPip + 1) + engine.GetRightEnd();
+    return index;
+}
+
+void tablebase::UnindexPosition(uint16_t players, const HandSizes& cards, uint64_t index, DominoEngine& engine)
+{
+    const uint32_t ends       = static_cast<uint32_t>(index % EndStates);
+    index /= EndStates;
+    const uint32_t first_turn = static_cast<uint32_t>(index % players);
+    index /= players;
+
+    std::array<TileMask, MaxPlayers> masks;
+    deal_index::UnrankPartition(DealIndex(index), cards.data(), players, masks.data());
+
+    engine.ClearPosition(players);
+    TileMask hands = 0;
+    uint16_t tiles = 0;
+    for (uint16_t p = 0; p < players; p++) {
+        hands |= masks[p];
+        tiles += cards[p];
+        for (TileMask m = masks[p]; m; m &= m - 1) {
+            engine.GiveTile(p, static_cast<uint8_t>(std::countr_zero(m)));
+        }
+    }
+    for (TileMask m = AllTiles & ~hands; m; m &= m - 1) {
+        engine.SetPlayedTile(static_cast<uint8_t>(std::countr_zero(m)));
+    }
+    engine.SetBoardEnds(static_cast<uint8_t>(ends / (HighestPip + 1)), static_cast<uint8_t>(ends % (HighestPip + 1)));
+    engine.SetTurns(0, static_cast<uint16_t>(first_turn), static_cast<uint16_t>(players * engine.GetNumberOfCards() - tiles));
+    engine.SetNumberOfPasses(0);
+}
+
+//-----------------------------------------------------------------------------------------------------------------------
+// MappedFile CLASS
+//-----------------------------------------------------------------------------------------------------------------------
+
+MappedFile::~MappedFile()
+{
+    this->Close();
+}
+
+bool MappedFile::OpenRead(const char* path)
+{
+    this->Close();
+#ifdef _WIN32
+    HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+    LARGE_INTEGER size{};
+    HANDLE mapping = GetFileSizeEx(file, &size) && size.QuadPart > 0 ? CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr) : nullptr;
+    void*  view    = mapping != nullptr ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+    // The view keeps the mapping alive
+    if (mapping != nullptr) {
+        CloseHandle(mapping);
+    }
+    CloseHandle(file);
+    if (view == nullptr) {
+        return false;
+    }
+    Size = static_cast<size_t>(size.QuadPart);
+#else
+    const int file = open(path, O_RDONLY);
+    if (file < 0) {
+        return false;
+    }
+    struct stat status{};
+    void* view = fstat(file, &status) == 0 && status.st_size > 0 ? mmap(nullptr, status.st_size, PROT_READ, MAP_SHARED, file, 0) : MAP_FAILED;
+    close(file);
+    if (view == MAP_FAILED) {
+        return false;
+    }
+    Size = static_cast<size_t>(status.st_size);
+#endif
+    Data = static_cast<uint8_t*>(view);
+    return true;
+}
+
+bool MappedFile::OpenWrite(const char* path, size_t size)
+{
+    this->Close();
+    if (size == 0) {
+        return false;
+    }
+#ifdef _WIN32
+    HANDLE file = CreateFileA(path, GENERIC_READ | GENERIC_WRITE, 0, nullptr, OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+    LARGE_INTEGER end{};
+    end.QuadPart = static_cast<LONGLONG>(size);
+    HANDLE mapping = SetFilePointerEx(file, end, nullptr, FILE_BEGIN) && SetEndOfFile(file) ?
+                     CreateFileMappingA(file, nullptr, PAGE_READWRITE, 0, 0, nullptr) : nullptr;
+    void*  view    = mapping != nullptr ? MapViewOfFile(mapping, FILE_MAP_WRITE, 0, 0, 0) : nullptr;
+    if (mapping != nullptr) {
+        CloseHandle(mapping);
+    }
+    if (view == nullptr) {
+        CloseHandle(file);
+        return false;
+    }
+    Handle = file;
+#else
+    const int file = open(path, O_RDWR | O_CREAT, 0644);
+    if (file < 0) {
+        return false;
+    }
+    void* view = ftruncate(file, static_cast<off_t>(size)) == 0 ? mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, file, 0) : MAP_FAILED;
+    close(file);
+    if (view == MAP_FAILED) {
+        return false;
+    }
+#endif
+    Data     = static_cast<uint8_t*>(view);
+    Size     = size;
+    Writable = true;
+    return true;
+}
+
+bool MappedFile::Flush()
+{
+    if (!Writable) {
+        return Data != nullptr;
+    }
+#ifdef _WIN32
+    return FlushViewOfFile(Data, 0) && FlushFileBuffers(Handle);
+#else
+    return msync(Data, Size, MS_SYNC) == 0;
+#endif
+}
+
+void MappedFile::Close()
+{
+    if (Data != nullptr) {
+#ifdef _WIN32
+        UnmapViewOfFile(Data);
+        if (Handle != nullptr) {
+            CloseHandle(Handle);
+        }
+#else
+        munmap(Data, Size);
+#endif
+    }
+    Data     = nullptr;
+    Size     = 0;
+    Handle   = nullptr;
+    Writable = false;
+}
+
+bool MappedFile::IsOpen() const
+{
+    return Data != nullptr;
+}
+
+const uint8_t* MappedFile::GetData() const
+{
+    return Data;
+}
+
+uint8_t* MappedFile::GetData()
+{
+    return Data;
+}
+
+size_t MappedFile::GetSize() const
+{
+    return Size;
+}
+
+//-----------------------------------------------------------------------------------------------------------------------
+// Tablebase CLASS
+//-----------------------------------------------------------------------------------------------------------------------
+
+Tablebase::~Tablebase()
+{
+    this->Close();
+}
+
+bool Tablebase::Open(const char* path)
+{
+    if (Ready.load(std::memory_order_acquire)) {
+        return true;
+    }
+    if (!File.OpenRead(path)) {
+        return false;
+    }
+
+    // Everything the probes rely on is checked once here
+    const uint8_t*  file      = File.GetData();
+    const size_t    file_size = File.GetSize();
+    TablebaseHeader header;
+    if (file_size < sizeof(header)) {
+        this->Close();
+        return false;
+    }
+    std::memcpy(&header, file, sizeof(header));
+    const bool header_ok = std::memcmp(header.Magic, Magic, sizeof(Magic)) == 0 && header.BlockSize == tablebase::BlockSize &&
+                           header.NumberOfPlayers >= MinPlayers && header.NumberOfPlayers <= MaxPlayers &&
+                           tablebase::Sections(header.NumberOfPlayers, header.MaxTiles).size() == header.NumberOfSections &&
+                           sizeof(header) + uint64_t(header.NumberOfSections) * sizeof(TablebaseSection) <= file_size;
+    if (!header_ok) {
+        this->Close();
+        return false;
+    }
+
+    Players  = header.NumberOfPlayers;
+    MaxTiles = header.MaxTiles;
+    Bits     = tablebase::ResultBits(Players);
+    Sections = reinterpret_cast<const TablebaseSection*>(file + sizeof(header));
+    SectionOfKey.assign(tablebase::NumberOfKeys(Players), NoSection);
+    for (uint32_t s = 0; s < header.NumberOfSections; s++) {
+        const TablebaseSection& section = Sections[s];
+        const uint64_t          blocks  = (section.NumberOfPositions + tablebase::BlockSize - 1) / tablebase::BlockSize;
+        const uint32_t          key     = tablebase::SectionKey(Players, section.Cards);
+        const bool section_ok = key != tablebase::NoKey && SectionOfKey[key] == NoSection && section.NumberOfPositions != 0 &&
+                                section.NumberOfPositions == tablebase::NumberOfPositions(Players, section.Cards) &&
+                                section.Blocks % alignof(uint64_t) == 0 && section.Blocks <= file_size &&
+                                (blocks + 1) * sizeof(uint64_t) <= file_size - section.Blocks &&
+                                section.Data <= file_size;
+        if (!section_ok || !BlocksInFile(section, blocks)) {
+            this->Close();
+            return false;
+        }
+        SectionOfKey[key] = s;
+    }
+
+    Ready.store(true, std::memory_order_release);
+    return true;
+}
+
+bool Tablebase::BlocksInFile(const TablebaseSection& section, uint64_t number_of_blocks) const
+{
+    const uint64_t* blocks = reinterpret_cast<const uint64_t*>(File.GetData() + section.Blocks);
+    for (uint64_t b = 0; b < number_of_blocks; b++) {
+        if (blocks[b] >= blocks[b + 1]) {
+            return false;
+        }
+    }
+    return blocks[number_of_blocks] <= File.GetSize() - section.Data;
+}
+
+void Tablebase::Close()
+{
+    Ready.store(false, std::memory_order_release);
+    File.Close();
+    Players  = 0;
+    MaxTiles = 0;
+    Bits     = 0;
+    Sections = nullptr;
+    SectionOfKey.clear();
+}
+
+bool Tablebase::IsOpen() const
+{
+    return Ready.load(std::memory_order_acquire);
+}
+
+uint16_t Tablebase::GetNumberOfPlayers() const
+{
+    return Players;
+}
+
+uint16_t Tablebase::GetMaxTiles() const
+{
+    return MaxTiles;
+}
+
+bool Tablebase::Probe(const DominoEngine& engine, uint16_t& winner) const
+{
+    // The hand sizes rule most positions out before anything is ranked
+    tablebase::HandSizes cards;
+    if (!Ready.load(std::memory_order_acquire) || engine.GetNumberOfPlayers() != Players || engine.NoDominoesYet() || tablebase::GetHandSizes(engine, cards) > MaxTiles) {
+        return false;
+    }
+    const uint32_t key = tablebase::SectionKey(Players, cards);
+    if (key == tablebase::NoKey || SectionOfKey[key] == NoSection) {
+        return false;
+    }
+
+    const TablebaseSection& section = Sections[SectionOfKey[key]];
+    const uint64_t          index   = tablebase::IndexPosition(engine);
+    const uint64_t*         blocks  = reinterpret_cast<const uint64_t*>(File.GetData() + section.Blocks);
+    const uint64_t          block   = index / tablebase::BlockSize;
+    const uint32_t          offset  = index % tablebase::BlockSize;
+
+    // A block of one result is a single byte. The packed blocks have a byte to spare, so a result can always be read
+    // from two bytes
+    const uint8_t* data = File.GetData() + section.Data + blocks[block];
+    uint32_t       result;
+    if (blocks[block + 1] - blocks[block] == 1) {
+        result = data[0];
+    }
+    else {
+        const uint32_t bit = offset * Bits;
+        result = ((data[bit / 8] | data[bit / 8 + 1] << 8) >> (bit % 8)) & ((1u << Bits) - 1);
+    }
+    winner = (engine.GetCurrentTurn() + result) % Players;
+    return true;
+}
+
+std::string Tablebase::DefaultPath(uint16_t players)
+{
+    return "domino_endgame_" + std::to_string(players) + ".tb";
+}
+
+//-----------------------------------------------------------------------------------------------------------------------
+// TablebaseWriter CLASS
+//-----------------------------------------------------------------------------------------------------------------------
+
+TablebaseWriter::~TablebaseWriter()
+{
+    if (File != nullptr) {
+        std::fclose(File);
+        std::error_code error;
+        std::filesystem::remove(this->TemporaryPath(), error);
+    }
+}
+
+void TablebaseWriter::Write(const void* data, size_t size)
+{
+    Failed   |= std::fwrite(data, 1, size, File) != size;
+    Position += size;
+}
+
+void TablebaseWriter::Align()
+{
+    static constexpr uint8_t zeros[alignof(uint64_t)] = {};
+    this->Write(zeros, (alignof(uint64_t) - Position % alignof(uint64_t)) % alignof(uint64_t));
+}
+
+std::string TablebaseWriter::TemporaryPath() const
+{
+    return Path + ".tmp";
+}
+
+bool TablebaseWriter::Fits(uint16_t players, uint16_t max_tiles)
+{
+    for (const tablebase::HandSizes& cards : tablebase::Sections(players, max_tiles)) {
+        if (tablebase::NumberOfPositions(players, cards) == 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool TablebaseWriter::Begin(const char* path, uint16_t players, uint16_t max_tiles)
+{
+    Sections.clear();
+    for (const tablebase::HandSizes& cards : tablebase::Sections(players, max_tiles)) {
+        TablebaseSection& section = Sections.emplace_back();
+        section.Cards             = cards;
+        section.NumberOfPositions = tablebase::NumberOfPositions(players, cards);
+        if (section.NumberOfPositions == 0) {
+            return false;
+        }
+    }
+
+    Bits = tablebase::ResultBits(players);
+    Path = path;
+    File = std::fopen(this->TemporaryPath().c_str(), "wb");
+    if (File == nullptr) {
+        return false;
+    }
+    TablebaseHeader header;
+    std::memcpy(header.Magic, Tablebase::Magic, sizeof(header.Magic));
+    header.NumberOfPlayers  = players;
+    header.MaxTiles         = max_tiles;
+    header.NumberOfSections = static_cast<uint32_t>(Sections.size());
+    header.BlockSize        = tablebase::BlockSize;
+
+    // The section table is written again by End, once the offsets are known
+    Written  = 0;
+    Position = 0;
+    Failed   = false;
+    this->Write(&header, sizeof(header));
+    this->Write(Sections.data(), Sections.size() * sizeof(TablebaseSection));
+    return !Failed;
+}
+
+bool TablebaseWriter::WriteSection(const uint8_t* results, uint64_t number_of_positions)
+{
+    if (File == nullptr || Written == Sections.size() || Sections[Written].NumberOfPositions != number_of_positions) {
+        return false;
+    }
+
+    TablebaseSection&     section = Sections[Written++];
+    std::vector<uint64_t> blocks;
+    std::vector<uint8_t>  packed;
+    section.Data = Position;
+    for (uint64_t start = 0; start < number_of_positions; start += tablebase::BlockSize) {
+        const uint64_t end = std::min<uint64_t>(start + tablebase::BlockSize, number_of_positions);
+        blocks.push_back(Position - section.Data);
+
+        if (std::all_of(results + start, results + end, [&](uint8_t result) { return result == results[start]; })) {
+            packed.assign(1, results[start]);
+        }
+        else {
+            packed.assign(((end - start) * Bits + 7) / 8 + 1, 0);
+            for (uint64_t i = start; i < end; i++) {
+                const uint64_t bit   = (i - start) * Bits;
+                const uint32_t value = results[i] << (bit % 8);
+                packed[bit / 8]     |= static_cast<uint8_t>(value);
+                packed[bit / 8 + 1] |= static_cast<uint8_t>(value >> 8);
+            }
+        }
+        this->Write(packed.data(), packed.size());
+    }
+    blocks.push_back(Position - section.Data);
+
+    this->Align();
+    section.Blocks = Position;
+    this->Write(blocks.data(), blocks.size() * sizeof(uint64_t));
+    return !Failed;
+}
+
+bool TablebaseWriter::End()
+{
+    if (File == nullptr) {
+        return false;
+    }
+    bool ok = Written == Sections.size() && !Failed;
+    ok = ok && std::fseek(File, sizeof(TablebaseHeader), SEEK_SET) == 0;
+    ok = ok && std::fwrite(Sections.data(), sizeof(TablebaseSection), Sections.size(), File) == Sections.size();
+    ok = std::fclose(File) == 0 && ok;
+    File = nullptr;
+
+    std::error_code error;
+    if (ok) {
+        std::filesystem::rename(this->TemporaryPath(), Path, error);
+    }
+    if (!ok || error) {
+        std::filesystem::remove(this->TemporaryPath(), error);
+        return false;
+    }
+    return true;
+}
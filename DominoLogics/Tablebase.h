@@ -0,0 +1,186 @@
+#pragma once
+
+#include "DominoEngine.h"
+#include <atomic>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+//-----------------------------------------------------------------------------------------------------------------------
+// Endgame tablebase of the block game.
+// Every position with a few tiles left in the hands is solved once and for all by the TablebaseGenerator tool and
+// looked up in O(1) during the searches. The result of a position is its winner under perfect play, the max-n play
+// of BasicDominoSearch::MaxN: the player to move takes a move they win with, or the first legal move if there's none.
+//
+// A position only depends on the hands, the open ends, the player to move and the first turn (the ties of a blocked
+// game go to the earliest player from it). Which of the other tiles are on the board and which were never dealt
+// doesn't matter, so unlike deal_index::RankPosition the index ranks the hands alone. The seats are rotated so the
+// player to move is seat 0 and the result is the winner counted from them.
+//
+// The positions are split in sections by their hand sizes, from the player to move on. A section is stored in blocks
+// of BlockSize results packed in ResultBits bits each, or in a single byte when the whole block has the same result.
+// The file is memory mapped, so only the blocks the searches look at are ever read.
+//-----------------------------------------------------------------------------------------------------------------------
+
+namespace tablebase
+{
+constexpr uint32_t BlockSize = 4096;
+// Both open ends, 0 to HighestPip each
+constexpr uint32_t EndStates = (dengine::HighestPip + 1) * (dengine::HighestPip + 1);
+
+using HandSizes = std::array<uint8_t, dengine::MaxPlayers>;
+
+// Bits of a packed result: 2 for four players, 3 for more
+constexpr uint32_t ResultBits(uint16_t players)
+{
+	return players > 4 ? 3 : 2;
+}
+
+// Hand sizes of the position from the player to move on. Returns the tiles in the hands
+uint16_t              GetHandSizes(const DominoEngine& engine, HandSizes& cards);
+// Dense key of the hand sizes of a section, below NumberOfKeys. NoKey if a hand is empty or has more than
+// dengine::CardsPerPlayer tiles
+constexpr uint32_t    NoKey = UINT32_MAX;
+uint32_t              SectionKey(uint16_t players, const HandSizes& cards);
+uint32_t              NumberOfKeys(uint16_t players);
+// The sections of a table with up to max_tiles tiles in the hands, fewest tiles first. Every hand has a tile at least,
+// an empty hand already won
+std::vector<HandSizes> Sections(uint16_t players, uint16_t max_tiles);
+// Positions of a section. 0 if they don't fit in 64 bits
+uint64_t              NumberOfPositions(uint16_t players, const HandSizes& cards);
+
+// Index of a position in its section. The board must have a tile
+uint64_t              IndexPosition(const DominoEngine& engine);
+// Sets up the position of the index, seat 0 to move. The tiles that aren't in the hands are on the board
+void                  UnindexPosition(uint16_t players, const HandSizes& cards, uint64_t index, DominoEngine& engine);
+}
+
+struct TablebaseHeader
+{
+	char     Magic[4];
+	uint16_t NumberOfPlayers;
+	uint16_t MaxTiles;
+	uint32_t NumberOfSections;
+	uint32_t BlockSize;
+};
+
+struct TablebaseSection
+{
+	tablebase::HandSizes Cards;
+	uint64_t             NumberOfPositions;
+	uint64_t             Blocks;     // File offset of the block offsets, one more than the blocks
+	uint64_t             Data;       // File offset the block offsets count from
+};
+
+//-----------------------------------------------------------------------------------------------------------------------
+// MappedFile CLASS
+//-----------------------------------------------------------------------------------------------------------------------
+
+// A whole file mapped in memory. The system pages it in and writes it back as it needs, so a file can be bigger than
+// the memory
+class MappedFile
+{
+private:
+	uint8_t* Data     = nullptr;
+	size_t   Size     = 0;
+	void*    Handle   = nullptr;     // The file of a writable mapping on Windows, to flush it
+	bool     Writable = false;
+
+public:
+	MappedFile() = default;
+	~MappedFile();
+	MappedFile(const MappedFile&) = delete;
+	MappedFile& operator = (const MappedFile&) = delete;
+
+	bool           OpenRead(const char* path);
+	// Creates the file or resizes it to size bytes, keeping what it had up to there
+	bool           OpenWrite(const char* path, size_t size);
+	// Returns once the changed pages are on the disk
+	bool           Flush();
+	void           Close();
+	bool           IsOpen() const;
+	const uint8_t* GetData() const;
+	uint8_t*       GetData();
+	size_t         GetSize() const;
+};
+
+//-----------------------------------------------------------------------------------------------------------------------
+// Tablebase CLASS
+//-----------------------------------------------------------------------------------------------------------------------
+
+// A memory mapped table of one number of players. Probe can be called from any number of threads, also while Open
+// maps the table: a probe misses until the table is fully set up. Close must wait until nothing probes anymore
+class Tablebase
+{
+private:
+	std::atomic<bool>              Ready    = false;    // Set last by Open, every other member is final by then
+	MappedFile                     File;
+	uint16_t                       Players  = 0;
+	uint16_t                       MaxTiles = 0;
+	uint32_t                       Bits     = 0;
+	const TablebaseSection*        Sections = nullptr;
+	std::vector<uint32_t>          SectionOfKey;      // NoSection for the hand sizes the table doesn't have
+
+	static constexpr uint32_t NoSection = UINT32_MAX;
+
+	// Every block of the section starts after the one before and ends in the file
+	bool BlocksInFile(const TablebaseSection& section, uint64_t number_of_blocks) const;
+
+public:
+	static constexpr char Magic[4] = { 'D', 'T', 'B', '1' };
+
+	Tablebase() = default;
+	~Tablebase();
+	Tablebase(const Tablebase&) = delete;
+	Tablebase& operator = (const Tablebase&) = delete;
+
+	// Maps the file. Returns true right away if it's already open
+	bool     Open(const char* path);
+	void     Close();
+	bool     IsOpen() const;
+	uint16_t GetNumberOfPlayers() const;
+	uint16_t GetMaxTiles() const;
+
+	// The winner of the position under perfect play. False if the position isn't in the table
+	bool     Probe(const DominoEngine& engine, uint16_t& winner) const;
+
+	// Default file of the tables of a number of players: domino_endgame_<players>.tb
+	static std::string DefaultPath(uint16_t players);
+};
+
+//-----------------------------------------------------------------------------------------------------------------------
+// TablebaseWriter CLASS
+//-----------------------------------------------------------------------------------------------------------------------
+
+// Writes a table section by section, in the order of tablebase::Sections. Results are one byte each, the winner
+// counted from the player to move. The table is written to TemporaryPath and End renames it over the path, so a table
+// already there stays whole until the new one is complete
+class TablebaseWriter
+{
+private:
+	std::FILE*                    File     = nullptr;
+	std::string                   Path;
+	std::vector<TablebaseSection> Sections;
+	uint32_t                      Written  = 0;
+	uint64_t                      Position = 0;       // Bytes written so far, ftell doesn't go past 2 GB everywhere
+	uint32_t                      Bits     = 0;
+	bool                          Failed   = false;
+
+	void        Write(const void* data, size_t size);
+	void        Align();
+	std::string TemporaryPath() const;
+
+public:
+	TablebaseWriter() = default;
+	// Removes the temporary file of a table that wasn't ended
+	~TablebaseWriter();
+
+	// False if a section of the table doesn't fit a 64-bit index. Nothing is written
+	static bool Fits(uint16_t players, uint16_t max_tiles);
+
+	bool Begin(const char* path, uint16_t players, uint16_t max_tiles);
+	bool WriteSection(const uint8_t* results, uint64_t number_of_positions);
+	// Fills the section table in and renames the file over the path. False if a section is missing or the file
+	// couldn't be written, the path keeps what it had then
+	bool End();
+};
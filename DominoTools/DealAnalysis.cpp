@@ -0,0 +1,333 @@
+// First player advantage analysis.
+//
+// Plays --deals deals for every player count with a fixed policy on every seat and counts the wins by turn order
+// (0 is the first turn player found by the highest double/highest tile rule) and by the opening tile. Every player
+// count gets the same number of deals, deal i of a player count is seeded with --seed + i.
+//
+// The deal range can be split with --shard k/K so every machine plays its own part, writing the partial counts with
+// --out. --merge adds up partial count files and prints the report.
+//
+// With --stratified the deal space is split by deal index (see DealIndex.h) into --deals equal strata and deal i is
+// drawn from stratum i, seeded with --seed + i. Every part of the deal space is covered evenly, which gives tighter
+// estimates than independent shuffles for the same number of deals, and the shards stay reproducible.
+//
+// Usage:
+//   DealAnalysis [--players 4-8 | 0 for all] [--deals N] [--seed N] [--policy random|normal] [--threads N]
+//                [--shard k/K] [--out counts.txt] [--stratified]
+//   DealAnalysis --merge counts1.txt counts2.txt ...
+
+#include "../DominoLogics/DealIndex.h"
+#include "../DominoLogics/DominoBot.h"
+#include <atomic>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+struct PlayerCountStats
+{
+    uint64_t Games   = 0;
+    uint64_t Blocked = 0;
+    std::array<uint64_t, dengine::MaxPlayers>    SeatWins{};         // By turn order from the first turn player
+    std::array<uint64_t, dengine::NumberOfTiles> OpeningGames{};
+    std::array<uint64_t, dengine::NumberOfTiles> OpeningWins{};      // Wins of the first turn player by opening tile
+
+    void Merge(const PlayerCountStats& other)
+    {
+        Games   += other.Games;
+        Blocked += other.Blocked;
+        for (size_t i = 0; i < SeatWins.size(); i++) {
+            SeatWins[i] += other.SeatWins[i];
+        }
+        for (size_t i = 0; i < OpeningGames.size(); i++) {
+            OpeningGames[i] += other.OpeningGames[i];
+            OpeningWins[i]  += other.OpeningWins[i];
+        }
+    }
+};
+
+using AnalysisStats = std::array<PlayerCountStats, dengine::MaxPlayers + 1>;
+
+struct AnalysisOptions
+{
+    uint16_t    Players    = 0;
+    uint64_t    Deals      = 100000;
+    uint32_t    Seed       = 1;
+    int         Policy     = AIDifficulty_Random;
+    uint32_t    Threads    = std::max(1u, std::thread::hardware_concurrency());
+    uint32_t    Shard      = 0;
+    uint32_t    Shards     = 1;
+    bool        Stratified = false;
+    std::string OutPath;
+    std::vector<std::string> MergePaths;
+};
+
+//-----------------------------------------------------------------------------------------------------------------------
+// Counting
+//-----------------------------------------------------------------------------------------------------------------------
+
+// Uniform deal index of stratum deal out of deals strata
+static DealIndex StratifiedDeal(uint16_t players, uint64_t deal, uint64_t deals, std::mt19937& rng)
+{
+    const DealIndex total = deal_index::NumberOfDeals(players);
+    DealIndex       begin = total, end = total, unused;
+    begin.MultiplyAdd(static_cast<uint32_t>(deal), 0);
+    end.MultiplyAdd(static_cast<uint32_t>(deal + 1), 0);
+    begin = begin.Divide(deals, unused);
+    end   = end.Divide(deals, unused);
+
+    DealIndex random;
+    random.High = (static_cast<uint64_t>(rng()) << 32) | rng();
+    random.Low  = (static_cast<uint64_t>(rng()) << 32) | rng();
+    DealIndex offset;
+    random.Divide(end - begin, offset);
+    return begin + offset;
+}
+
+static void PlayDeals(uint16_t players, uint64_t begin, uint64_t end, const AnalysisOptions& options, std::atomic<uint64_t>& next_deal, PlayerCountStats& stats, std::mutex& merge_mutex)
+{
+    DominoBot        bot(options.Policy);
+    DominoEngine     engine;
+    PlayerCountStats local;
+    std::array<const DominoBot*, dengine::MaxPlayers> seats;
+    seats.fill(&bot);
+
+    for (uint64_t deal = next_deal++; deal < end - begin; deal = next_deal++) {
+        const uint32_t seed = options.Seed + static_cast<uint32_t>(begin + deal);
+        std::mt19937   rng(seed ^ 0x27D4EB2Fu);
+        if (options.Stratified) {
+            deal_index::UnrankDeal(players, StratifiedDeal(players, begin + deal, options.Deals, rng), engine);
+        }
+        else {
+            engine.NewGame(players, seed);
+        }
+
+        const uint8_t  opening_tile = engine.GetRequiredTile();
+        const uint16_t first_turn   = engine.GetFirstTurn();
+        const uint16_t winner       = DominoBot::PlayGame(engine, seats.data(), rng);
+        const uint16_t turn_order   = (winner + players - first_turn) % players;
+
+        local.Games++;
+        local.Blocked += engine.RemainingCards(winner) != 0;
+        local.SeatWins[turn_order]++;
+        if (opening_tile != dengine::NoTile) {
+            local.OpeningGames[opening_tile]++;
+            local.OpeningWins[opening_tile] += turn_order == 0;
+        }
+    }
+
+    std::lock_guard lock(merge_mutex);
+    stats.Merge(local);
+}
+
+static void RunAnalysis(const AnalysisOptions& options, AnalysisStats& stats)
+{
+    // The shard's part of the deal range, the same for every player count
+    const uint64_t begin = options.Deals * options.Shard / options.Shards;
+    const uint64_t end   = options.Deals * (options.Shard + 1) / options.Shards;
+
+    for (uint16_t players = dengine::MinPlayers; players <= dengine::MaxPlayers; players++) {
+        if (options.Players != 0 && options.Players != players) {
+            continue;
+        }
+
+        std::mutex               merge_mutex;
+        std::atomic<uint64_t>    next_deal = 0;
+        std::vector<std::thread> workers;
+        for (uint32_t t = 0; t < options.Threads; t++) {
+            workers.emplace_back(PlayDeals, players, begin, end, std::cref(options), std::ref(next_deal), std::ref(stats[players]), std::ref(merge_mutex));
+        }
+        for (auto& worker : workers) {
+            worker.join();
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------------------------------------------------
+// Partial counts files
+//-----------------------------------------------------------------------------------------------------------------------
+
+static bool WriteCounts(const char* path, const AnalysisStats& stats)
+{
+    std::ofstream file(path, std::ios::trunc);
+    if (!file) {
+        return false;
+    }
+
+    file << "# DealAnalysis counts\n";
+    for (uint16_t players = dengine::MinPlayers; players <= dengine::MaxPlayers; players++) {
+        const auto& S = stats[players];
+        if (S.Games == 0) {
+            continue;
+        }
+        file << "games " << players << ' ' << S.Games << ' ' << S.Blocked << '\n';
+        for (uint16_t seat = 0; seat < players; seat++) {
+            file << "seat " << players << ' ' << seat << ' ' << S.SeatWins[seat] << '\n';
+        }
+        for (uint16_t tile = 0; tile < dengine::NumberOfTiles; tile++) {
+            if (S.OpeningGames[tile] != 0) {
+                file << "opening " << players << ' ' << tile << ' ' << S.OpeningGames[tile] << ' ' << S.OpeningWins[tile] << '\n';
+            }
+        }
+    }
+    return static_cast<bool>(file);
+}
+
+static bool ReadCounts(const char* path, AnalysisStats& stats)
+{
+    std::ifstream file(path);
+    if (!file) {
+        return false;
+    }
+
+    std::string line;
+    while (std::getline(file, line)) {
+        if (line.empty() || line[0] == '#') {
+            continue;
+        }
+
+        std::istringstream in(line);
+        std::string kind;
+        uint64_t players = 0, a = 0, b = 0, c = 0;
+        in >> kind >> players >> a >> b;
+        if (!in || players < dengine::MinPlayers || players > dengine::MaxPlayers) {
+            return false;
+        }
+
+        PlayerCountStats partial;
+        if (kind == "games") {
+            partial.Games   = a;
+            partial.Blocked = b;
+        }
+        else if (kind == "seat" && a < players) {
+            partial.SeatWins[a] = b;
+        }
+        else if (kind == "opening" && a < dengine::NumberOfTiles && (in >> c)) {
+            partial.OpeningGames[a] = b;
+            partial.OpeningWins[a]  = c;
+        }
+        else {
+            return false;
+        }
+        stats[players].Merge(partial);
+    }
+    return true;
+}
+
+static void PrintReport(const AnalysisStats& stats)
+{
+    for (uint16_t players = dengine::MinPlayers; players <= dengine::MaxPlayers; players++) {
+        const auto& S = stats[players];
+        if (S.Games == 0) {
+            continue;
+        }
+
+        const double fair = 1.0 / players;
+        std::printf("\n%d players: %llu deals, %.2f%% blocked\n", players, static_cast<unsigned long long>(S.Games), 100.0 * S.Blocked / S.Games);
+        for (uint16_t seat = 0; seat < players; seat++) {
+            const double rate   = static_cast<double>(S.SeatWins[seat]) / S.Games;
+            const double margin = 1.96 * std::sqrt(rate * (1.0 - rate) / S.Games);
+            std::printf("  turn %d: %6.2f%% +- %.2f%%  (%+.2f%% over a fair share)\n", seat + 1, 100.0 * rate, 100.0 * margin, 100.0 * (rate - fair));
+        }
+
+        std::printf("  first turn player win rate by opening tile:\n");
+        for (uint16_t tile = 0; tile < dengine::NumberOfTiles; tile++) {
+            if (S.OpeningGames[tile] == 0) {
+                continue;
+            }
+            std::printf("    %d|%d: %6.2f%% of %llu deals\n", dengine::Tiles[tile].Left, dengine::Tiles[tile].Right,
+                100.0 * S.OpeningWins[tile] / S.OpeningGames[tile], static_cast<unsigned long long>(S.OpeningGames[tile]));
+        }
+    }
+}
+
+static bool ParseOptions(int argc, char** argv, AnalysisOptions& options)
+{
+    for (int i = 1; i < argc; i++) {
+        const char* arg = argv[i];
+        if (!std::strcmp(arg, "--merge")) {
+            while (i + 1 < argc) {
+                options.MergePaths.emplace_back(argv[++i]);
+            }
+            return !options.MergePaths.empty();
+        }
+        if (!std::strcmp(arg, "--stratified")) {
+            options.Stratified = true;
+            continue;
+        }
+
+        const char* value = i + 1 < argc ? argv[++i] : nullptr;
+        if (value == nullptr) {
+            std::fprintf(stderr, "Missing value for %s\n", arg);
+            return false;
+        }
+
+        if      (!std::strcmp(arg, "--players")) options.Players = static_cast<uint16_t>(std::strtoul(value, nullptr, 10));
+        else if (!std::strcmp(arg, "--deals"))   options.Deals   = std::strtoull(value, nullptr, 10);
+        else if (!std::strcmp(arg, "--seed"))    options.Seed    = static_cast<uint32_t>(std::strtoul(value, nullptr, 10));
+        else if (!std::strcmp(arg, "--threads")) options.Threads = std::max(1ul, std::strtoul(value, nullptr, 10));
+        else if (!std::strcmp(arg, "--out"))     options.OutPath = value;
+        else if (!std::strcmp(arg, "--policy")) {
+            if      (!std::strcmp(value, "random")) options.Policy = AIDifficulty_Random;
+            else if (!std::strcmp(value, "normal")) options.Policy = AIDifficulty_Normal;
+            else {
+                std::fprintf(stderr, "Unknown policy %s\n", value);
+                return false;
+            }
+        }
+        else if (!std::strcmp(arg, "--shard")) {
+            if (std::sscanf(value, "%u/%u", &options.Shard, &options.Shards) != 2 || options.Shards == 0 || options.Shard >= options.Shards) {
+                std::fprintf(stderr, "--shard must be k/K with k < K\n");
+                return false;
+            }
+        }
+        else {
+            std::fprintf(stderr, "Unknown option %s\n", arg);
+            return false;
+        }
+    }
+
+    if (options.Players != 0 && (options.Players < dengine::MinPlayers || options.Players > dengine::MaxPlayers)) {
+        std::fprintf(stderr, "--players must be between 4 and 8, or 0 for every player count\n");
+        return false;
+    }
+    if (options.Stratified && options.Deals > UINT32_MAX) {
+        std::fprintf(stderr, "--stratified supports up to %u deals\n", UINT32_MAX);
+        return false;
+    }
+    return true;
+}
+
+int main(int argc, char** argv)
+{
+    AnalysisOptions options;
+    if (!ParseOptions(argc, argv, options)) {
+        return 1;
+    }
+
+    AnalysisStats stats;
+    if (!options.MergePaths.empty()) {
+        for (const auto& path : options.MergePaths) {
+            if (!ReadCounts(path.c_str(), stats)) {
+                std::fprintf(stderr, "Could not read the counts from %s\n", path.c_str());
+                return 1;
+            }
+        }
+        PrintReport(stats);
+        return 0;
+    }
+
+    RunAnalysis(options, stats);
+    if (!options.OutPath.empty() && !WriteCounts(options.OutPath.c_str(), stats)) {
+        std::fprintf(stderr, "Could not write the counts to %s\n", options.OutPath.c_str());
+        return 1;
+    }
+    PrintReport(stats);
+    return 0;
+}
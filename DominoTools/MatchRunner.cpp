@@ -0,0 +1,303 @@
+// Strength check between two AI configurations.
+//
+// Configuration A and B are seated on random seats of a 4-8 player table, the other seats are filled with the
+// --filler AI. A game scores 1 for A when A wins, 0 when B wins and 0.5 when a filler wins. Games are played in
+// parallel and the run stops as soon as the sequential probability ratio test accepts elo1 (A is stronger) or elo0
+// (A is not stronger), or when --games are played.
+//
+// With --duplicate every seeded deal is replayed like duplicate bridge: the table line up is rotated through every
+// seat and A and B swap places, so both configurations play every hand from every seat against the same fillers.
+// The luck of the deal cancels out and the whole block of 2 x players games is one sample of the SPRT, so far less
+// games are needed for the same confidence. --games then counts deals instead of games. Deal i uses the seed
+// --seed + i, the same seeds DominoGameStructure::DistributeCards shows in the Game Logs window, so a deal from the
+// game can be replayed with --seed <deal seed> --games 1.
+//
+// --rules draw or --rules allfives plays the boneyard variants instead of the game's block rules.
+//
+// The Hard bots of every thread share a --hash MB transposition table, 0 turns it off. With --tablebase the Hard
+// and GigaBrain bots look the endgame positions up in the table of TablebaseGenerator, for its number of players.
+//
+// Usage:
+//   MatchRunner [--a random|normal|hard|gigabrain] [--a-weights path] [--b ...] [--b-weights path]
+//               [--filler random] [--players 4-8 | 0 for all] [--games N] [--threads N] [--seed N]
+//               [--elo0 F] [--elo1 F] [--alpha F] [--beta F] [--no-sprt] [--duplicate]
+//               [--rules block|draw|allfives] [--hash MB] [--tablebase path]
+
+#include "../DominoLogics/DominoBot.h"
+#include "MatchStatistics.h"
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+struct MatchOptions
+{
+    int         ADifficulty      = AIDifficulty_Normal;
+    int         BDifficulty      = AIDifficulty_Random;
+    int         FillerDifficulty = AIDifficulty_Random;
+    std::string AWeights;
+    std::string BWeights;
+    uint16_t    Players          = 0;
+    uint64_t    Games            = 100000;
+    uint32_t    Threads          = std::max(1u, std::thread::hardware_concurrency());
+    uint32_t    Seed             = 1;
+    double      Elo0             = 0.0;
+    double      Elo1             = 10.0;
+    double      Alpha            = 0.05;
+    double      Beta             = 0.05;
+    bool        UseSprt          = true;
+    bool        Duplicate        = false;
+    std::string Rules            = dengine::BlockRules::Name;
+    uint32_t    HashMB           = 64;
+    std::string TablebasePath;
+};
+
+static bool ParseDifficulty(const char* value, int& difficulty)
+{
+    static const char* Names[] = { "random", "normal", "hard", "gigabrain" };
+    for (int i = 0; i < 4; i++) {
+        if (!std::strcmp(value, Names[i])) {
+            difficulty = i;
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool ParseOptions(int argc, char** argv, MatchOptions& options)
+{
+    for (int i = 1; i < argc; i++) {
+        const char* arg = argv[i];
+        if (!std::strcmp(arg, "--no-sprt")) {
+            options.UseSprt = false;
+            continue;
+        }
+        if (!std::strcmp(arg, "--duplicate")) {
+            options.Duplicate = true;
+            continue;
+        }
+
+        const char* value = i + 1 < argc ? argv[++i] : nullptr;
+        if (value == nullptr) {
+            std::fprintf(stderr, "Missing value for %s\n", arg);
+            return false;
+        }
+
+        bool valid = true;
+        if      (!std::strcmp(arg, "--a"))         valid = ParseDifficulty(value, options.ADifficulty);
+        else if (!std::strcmp(arg, "--b"))         valid = ParseDifficulty(value, options.BDifficulty);
+        else if (!std::strcmp(arg, "--filler"))    valid = ParseDifficulty(value, options.FillerDifficulty);
+        else if (!std::strcmp(arg, "--a-weights")) options.AWeights = value;
+        else if (!std::strcmp(arg, "--b-weights")) options.BWeights = value;
+        else if (!std::strcmp(arg, "--players"))   options.Players  = static_cast<uint16_t>(std::strtoul(value, nullptr, 10));
+        else if (!std::strcmp(arg, "--games"))     options.Games    = std::strtoull(value, nullptr, 10);
+        else if (!std::strcmp(arg, "--threads"))   options.Threads  = std::max(1ul, std::strtoul(value, nullptr, 10));
+        else if (!std::strcmp(arg, "--seed"))      options.Seed     = static_cast<uint32_t>(std::strtoul(value, nullptr, 10));
+        else if (!std::strcmp(arg, "--elo0"))      options.Elo0     = std::strtod(value, nullptr);
+        else if (!std::strcmp(arg, "--elo1"))      options.Elo1     = std::strtod(value, nullptr);
+        else if (!std::strcmp(arg, "--alpha"))     options.Alpha    = std::strtod(value, nullptr);
+        else if (!std::strcmp(arg, "--beta"))      options.Beta     = std::strtod(value, nullptr);
+        else if (!std::strcmp(arg, "--rules"))     options.Rules    = value;
+        else if (!std::strcmp(arg, "--hash"))      options.HashMB   = static_cast<uint32_t>(std::strtoul(value, nullptr, 10));
+        else if (!std::strcmp(arg, "--tablebase")) options.TablebasePath = value;
+        else {
+            std::fprintf(stderr, "Unknown option %s\n", arg);
+            return false;
+        }
+
+        if (!valid) {
+            std::fprintf(stderr, "Unknown AI difficulty %s\n", value);
+            return false;
+        }
+    }
+
+    if (options.Players != 0 && (options.Players < dengine::MinPlayers || options.Players > dengine::MaxPlayers)) {
+        std::fprintf(stderr, "--players must be between 4 and 8, or 0 for every table size\n");
+        return false;
+    }
+    if (options.Rules != dengine::BlockRules::Name && options.Rules != dengine::DrawRules::Name && options.Rules != dengine::AllFivesRules::Name) {
+        std::fprintf(stderr, "--rules must be block, draw or allfives\n");
+        return false;
+    }
+    return true;
+}
+
+static bool LoadBot(DominoBot& bot, int difficulty, const std::string& weights)
+{
+    bot.SetDifficulty(difficulty);
+    if (!weights.empty() && !bot.LoadWeights(weights.c_str())) {
+        std::fprintf(stderr, "Could not load the weights from %s\n", weights.c_str());
+        return false;
+    }
+    return true;
+}
+
+struct SharedMatch
+{
+    std::mutex            Mutex;
+    MatchScore            Score;
+    std::atomic<uint64_t> NextGame = 0;
+    std::atomic<bool>     Stop     = false;
+};
+
+// Plays the deal with the line up rotated through every seat and A and B swapped. Every game of the block uses the
+// same random numbers so the fillers' choices cancel out as well
+template<typename Engine>
+static void DuplicateDeal(const MatchOptions& options, const DominoBot& bot_a, const DominoBot& bot_b, const DominoBot& filler, uint64_t deal, SharedMatch& shared)
+{
+    const uint32_t deal_seed = options.Seed + static_cast<uint32_t>(deal);
+    const uint16_t players   = options.Players != 0 ? options.Players : static_cast<uint16_t>(dengine::MinPlayers + deal % 5);
+    const uint16_t b_offset  = static_cast<uint16_t>(1 + (deal / 5) % (players - 1));  // Next to A, across A, ...
+
+    Engine     engine;
+    MatchScore block;
+    std::array<const DominoBot*, dengine::MaxPlayers> seats;
+
+    for (uint16_t rotation = 0; rotation < players; rotation++) {
+        for (int swap = 0; swap < 2; swap++) {
+            const uint16_t a_seat = swap ? (rotation + b_offset) % players : rotation;
+            const uint16_t b_seat = swap ? rotation : (rotation + b_offset) % players;
+            seats.fill(&filler);
+            seats[a_seat] = &bot_a;
+            seats[b_seat] = &bot_b;
+
+            std::mt19937 rng(deal_seed ^ 0x85EBCA6Bu);
+            engine.NewGame(players, deal_seed);
+            const uint16_t winner = DominoBot::PlayGame(engine, seats.data(), rng);
+            block.AddGame(winner == a_seat ? 1.0 : (winner == b_seat ? 0.0 : 0.5));
+        }
+    }
+
+    std::lock_guard lock(shared.Mutex);
+    shared.Score.AddBlock(block);
+}
+
+template<typename Engine>
+static void MatchWorker(const MatchOptions& options, const DominoBot& bot_a, const DominoBot& bot_b, const DominoBot& filler, SharedMatch& shared)
+{
+    Engine engine;
+    std::array<const DominoBot*, dengine::MaxPlayers> seats;
+
+    for (uint64_t game = shared.NextGame++; game < options.Games && !shared.Stop; game = shared.NextGame++) {
+        if (options.Duplicate) {
+            DuplicateDeal<Engine>(options, bot_a, bot_b, filler, game, shared);
+            continue;
+        }
+
+        const uint32_t game_seed = options.Seed + static_cast<uint32_t>(game);
+        const uint16_t players   = options.Players != 0 ? options.Players : static_cast<uint16_t>(dengine::MinPlayers + game % 5);
+        std::mt19937   rng(game_seed ^ 0x85EBCA6Bu);
+
+        // A and B on two different random seats, fillers everywhere else
+        const uint16_t a_seat = std::uniform_int_distribution<uint16_t>(0, players - 1)(rng);
+        const uint16_t b_seat = (a_seat + std::uniform_int_distribution<uint16_t>(1, players - 1)(rng)) % players;
+        seats.fill(&filler);
+        seats[a_seat] = &bot_a;
+        seats[b_seat] = &bot_b;
+
+        engine.NewGame(players, game_seed);
+        const uint16_t winner = DominoBot::PlayGame(engine, seats.data(), rng);
+        const double   score  = winner == a_seat ? 1.0 : (winner == b_seat ? 0.0 : 0.5);
+
+        std::lock_guard lock(shared.Mutex);
+        shared.Score.AddGame(score);
+        shared.Score.AddSample(score);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    MatchOptions options;
+    if (!ParseOptions(argc, argv, options)) {
+        return 1;
+    }
+
+    DominoBot bot_a, bot_b, filler(options.FillerDifficulty);
+    if (!LoadBot(bot_a, options.ADifficulty, options.AWeights) || !LoadBot(bot_b, options.BDifficulty, options.BWeights)) {
+        return 1;
+    }
+
+    std::unique_ptr<TranspositionTable> table;
+    if (options.HashMB > 0) {
+        table = std::make_unique<TranspositionTable>(size_t(options.HashMB) << 20);
+        for (DominoBot* bot : { &bot_a, &bot_b, &filler }) {
+            bot->SetTranspositionTable(table.get());
+        }
+    }
+
+    Tablebase endgame;
+    if (!options.TablebasePath.empty()) {
+        if (!endgame.Open(options.TablebasePath.c_str())) {
+            std::fprintf(stderr, "Could not open the tablebase %s\n", options.TablebasePath.c_str());
+            return 1;
+        }
+        for (DominoBot* bot : { &bot_a, &bot_b, &filler }) {
+            bot->SetTablebase(&endgame);
+        }
+    }
+
+    auto worker_function = MatchWorker<DominoEngine>;
+    if (options.Rules == dengine::DrawRules::Name) {
+        worker_function = MatchWorker<BasicDominoEngine<dengine::DoubleSix, dengine::DrawRules>>;
+    }
+    else if (options.Rules == dengine::AllFivesRules::Name) {
+        worker_function = MatchWorker<BasicDominoEngine<dengine::DoubleSix, dengine::AllFivesRules>>;
+    }
+
+    SharedMatch shared;
+    const auto  start = std::chrono::steady_clock::now();
+    std::vector<std::thread> workers;
+    for (uint32_t t = 0; t < options.Threads; t++) {
+        workers.emplace_back(worker_function, std::cref(options), std::cref(bot_a), std::cref(bot_b), std::cref(filler), std::ref(shared));
+    }
+
+    int  sprt_result = SprtResult_Continue;
+    auto last_report = start;
+    while (true) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+        MatchScore score;
+        {
+            std::lock_guard lock(shared.Mutex);
+            score = shared.Score;
+        }
+
+        const bool finished = score.Samples >= options.Games;
+        if (options.UseSprt) {
+            sprt_result = match_stats::SprtTest(score, options.Elo0, options.Elo1, options.Alpha, options.Beta);
+        }
+
+        const auto now = std::chrono::steady_clock::now();
+        if (now - last_report > std::chrono::seconds(1) || finished || sprt_result != SprtResult_Continue) {
+            last_report = now;
+            const EloEstimate elo = match_stats::ComputeElo(score);
+            std::printf("%s: %llu  W-D-L: %llu-%llu-%llu  elo: %+.1f [%+.1f, %+.1f]  llr: %.2f\n", options.Duplicate ? "deals" : "games",
+                static_cast<unsigned long long>(score.Samples), static_cast<unsigned long long>(score.Wins),
+                static_cast<unsigned long long>(score.Draws), static_cast<unsigned long long>(score.Losses),
+                elo.Elo, elo.Lower, elo.Upper, match_stats::SprtLLR(score, options.Elo0, options.Elo1));
+            std::fflush(stdout);
+        }
+
+        if (finished || sprt_result != SprtResult_Continue) {
+            break;
+        }
+    }
+
+    shared.Stop = true;
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    if (sprt_result == SprtResult_AcceptH1)      std::printf("SPRT: H1 accepted, A is at least %+.1f elo stronger\n", options.Elo1);
+    else if (sprt_result == SprtResult_AcceptH0) std::printf("SPRT: H0 accepted, A is not %+.1f elo stronger\n", options.Elo1);
+    else                                         std::printf("SPRT: inconclusive\n");
+    std::printf("finished in %.1f seconds\n", seconds);
+    return 0;
+}
@@ -0,0 +1,99 @@
+#include "MatchStatistics.h"
+#include <algorithm>
+#include <cmath>
+
+//-----------------------------------------------------------------------------------------------------------------------
+// MatchScore STRUCT
+//-----------------------------------------------------------------------------------------------------------------------
+
+void MatchScore::AddGame(double score)
+{
+    score > 0.75 ? Wins++ : (score < 0.25 ? Losses++ : Draws++);
+}
+
+void MatchScore::AddSample(double score)
+{
+    Samples++;
+    ScoreSum   += score;
+    ScoreSqSum += score * score;
+}
+
+void MatchScore::AddBlock(const MatchScore& block)
+{
+    const uint64_t games = block.Wins + block.Draws + block.Losses;
+    Wins   += block.Wins;
+    Draws  += block.Draws;
+    Losses += block.Losses;
+    this->AddSample(games == 0 ? 0.5 : (block.Wins + 0.5 * block.Draws) / games);
+}
+
+void MatchScore::Merge(const MatchScore& other)
+{
+    Wins       += other.Wins;
+    Draws      += other.Draws;
+    Losses     += other.Losses;
+    Samples    += other.Samples;
+    ScoreSum   += other.ScoreSum;
+    ScoreSqSum += other.ScoreSqSum;
+}
+
+double MatchScore::Mean() const
+{
+    return Samples == 0 ? 0.5 : ScoreSum / Samples;
+}
+
+double MatchScore::Variance() const
+{
+    if (Samples < 2) {
+        return 0.25;
+    }
+    const double mean = Mean();
+    return std::max(ScoreSqSum / Samples - mean * mean, 1e-9);
+}
+
+//-----------------------------------------------------------------------------------------------------------------------
+// Elo and SPRT
+//-----------------------------------------------------------------------------------------------------------------------
+
+namespace match_stats
+{
+double EloToScore(double elo)
+{
+    return 1.0 / (1.0 + std::pow(10.0, -elo / 400.0));
+}
+
+double ScoreToElo(double score)
+{
+    score = std::clamp(score, 1e-6, 1.0 - 1e-6);
+    return -400.0 * std::log10(1.0 / score - 1.0);
+}
+
+EloEstimate ComputeElo(const MatchScore& score, double z)
+{
+    const double mean   = score.Mean();
+    const double margin = score.Samples == 0 ? 0.5 : z * std::sqrt(score.Variance() / score.Samples);
+    return { ScoreToElo(mean), ScoreToElo(mean - margin), ScoreToElo(mean + margin) };
+}
+
+double SprtLLR(const MatchScore& score, double elo0, double elo1)
+{
+    if (score.Samples < 2) {
+        return 0.0;
+    }
+
+    const double s0 = EloToScore(elo0);
+    const double s1 = EloToScore(elo1);
+    return score.Samples * (s1 - s0) * (2.0 * score.Mean() - s0 - s1) / (2.0 * score.Variance());
+}
+
+int SprtTest(const MatchScore& score, double elo0, double elo1, double alpha, double beta)
+{
+    const double llr   = SprtLLR(score, elo0, elo1);
+    const double lower = std::log(beta / (1.0 - alpha));
+    const double upper = std::log((1.0 - beta) / alpha);
+
+    if (llr >= upper) return SprtResult_AcceptH1;
+    if (llr <= lower) return SprtResult_AcceptH0;
+    return SprtResult_Continue;
+}
+}
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstdint>
+
+// Score of configuration A against configuration B. Every sample is the score of one independent unit of play
+// (a game, or a whole block of games that share a deal), 1 for an A win, 0 for a B win and 0.5 for neither
+struct MatchScore
+{
+	uint64_t Wins         = 0;
+	uint64_t Draws        = 0;
+	uint64_t Losses       = 0;
+	uint64_t Samples      = 0;
+	double   ScoreSum     = 0.0;
+	double   ScoreSqSum   = 0.0;
+
+	void   AddGame(double score);
+	void   AddSample(double score);
+	// Adds the games of a block of AddGame and its mean score as a single sample
+	void   AddBlock(const MatchScore& block);
+	void   Merge(const MatchScore& other);
+	double Mean() const;
+	double Variance() const;
+};
+
+struct EloEstimate
+{
+	double Elo;
+	double Lower;
+	double Upper;
+};
+
+enum SprtResult_
+{
+	SprtResult_Continue,
+	SprtResult_AcceptH0,   // A is not stronger than elo0
+	SprtResult_AcceptH1    // A is at least elo1 stronger
+};
+
+namespace match_stats
+{
+double      EloToScore(double elo);
+double      ScoreToElo(double score);
+// Elo difference of A over B with the confidence interval for the given z value (1.96 for 95%)
+EloEstimate ComputeElo(const MatchScore& score, double z = 1.96);
+// Generalized SPRT log likelihood ratio of elo1 against elo0 with a normal approximation of the sample score
+double      SprtLLR(const MatchScore& score, double elo0, double elo1);
+int         SprtTest(const MatchScore& score, double elo0, double elo1, double alpha, double beta);
+}
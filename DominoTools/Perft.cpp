@@ -0,0 +1,408 @@
+// Perft for the domino engine.
+//
+// Counts every legal move sequence of a seeded deal until the games end, forced passes and the blocked game ending
+// included, and reports the node count of every depth and the nodes per second. The counts only depend on the deal
+// and the rules, so they are a correctness oracle for any optimized engine and a deterministic speed benchmark of
+// move generation and move making. The tree is walked in place with MakeMove and UnmakeMove, so an undo that doesn't
+// give back the exact position shows up in the counts.
+//
+// --verify also checks every node's legal moves and resulting board ends against Domino2D::ConnectDomino, the
+// function the game itself uses to connect tiles. It needs the tool built with PERFT_VERIFY_WITH_GAMELOGIC defined
+// and linked with GameLogic.cpp and the imgui sources.
+//
+// --deals N runs the deals of the seeds --seed ... --seed + N - 1 and adds up their counts, for benchmarks that run
+// long enough to be measured.
+//
+// --set 9 or --set 12 runs the same perft with the double-nine or double-twelve set (up to 12 and 16 players) and
+// --cards overrides the number of cards dealt to every player.
+//
+// --rules draw or --rules allfives runs the double-six deal with the boneyard variants. Every draw is expanded into
+// one child per boneyard tile, so the counts stay deterministic.
+//
+// Usage:
+//   Perft [--players 4-16] [--seed N] [--deals N] [--depth N] [--threads N] [--first-turn P] [--verify]
+//         [--set 6|9|12] [--cards N] [--rules block|draw|allfives]
+
+#include "../DominoLogics/DominoEngine.h"
+#ifdef PERFT_VERIFY_WITH_GAMELOGIC
+#include "../DominoLogics/GameLogic.h"
+#endif
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+constexpr int MaxPerftDepth = 256;
+
+struct PerftCounts
+{
+    std::array<uint64_t, MaxPerftDepth> Nodes{};   // Positions reached after every depth
+    uint64_t Passes      = 0;
+    uint64_t Draws       = 0;
+    uint64_t Wins        = 0;                      // Games ended by a player emptying the hand
+    uint64_t Blocked     = 0;                      // Games ended with FindTheLowestSum
+    uint64_t Mismatches  = 0;                      // --verify failures
+    int      DeepestPly  = 0;
+
+    void Merge(const PerftCounts& other)
+    {
+        for (int d = 0; d < MaxPerftDepth; d++) {
+            Nodes[d] += other.Nodes[d];
+        }
+        Passes     += other.Passes;
+        Draws      += other.Draws;
+        Wins       += other.Wins;
+        Blocked    += other.Blocked;
+        Mismatches += other.Mismatches;
+        DeepestPly  = std::max(DeepestPly, other.DeepestPly);
+    }
+
+    uint64_t TotalNodes() const
+    {
+        uint64_t total = 0;
+        for (auto n : Nodes) {
+            total += n;
+        }
+        return total;
+    }
+};
+
+struct PerftOptions
+{
+    uint16_t    Players   = 8;
+    uint32_t    Seed      = 1;
+    uint32_t    Deals     = 1;
+    int         MaxDepth  = MaxPerftDepth - 1;
+    uint32_t    Threads   = std::max(1u, std::thread::hardware_concurrency());
+    int         FirstTurn = -1;
+    bool        Verify    = false;
+    uint16_t    Set       = 6;
+    uint16_t    Cards     = 0;
+    std::string Rules     = "block";
+};
+
+//-----------------------------------------------------------------------------------------------------------------------
+// Verification against Domino2D::ConnectDomino
+//-----------------------------------------------------------------------------------------------------------------------
+
+#ifdef PERFT_VERIFY_WITH_GAMELOGIC
+// Rebuilds the legal placements of the current player by connecting every tile of the hand to a domino showing the
+// open end, the same way the game connects a clicked tile to the latest left and right side dominoes
+static bool VerifyMoves(const DominoEngine& engine, const DominoMoveList& moves)
+{
+    if (engine.NoDominoesYet()) {
+        return true;
+    }
+
+    DominoMoveList expected;
+    std::array<uint8_t, 2> expected_ends[16];
+    for (int pos = TileDropPosition_Left; pos <= TileDropPosition_Right; pos++) {
+        const uint8_t end = pos == TileDropPosition_Left ? engine.GetLeftEnd() : engine.GetRightEnd();
+        for (dengine::TileMask m = engine.GetHand(engine.GetCurrentTurn()); m; m &= m - 1) {
+            const uint8_t tile = static_cast<uint8_t>(std::countr_zero(m));
+            Domino2D connectee(end, end);
+            Domino2D domino(dengine::Tiles[tile].Left, dengine::Tiles[tile].Right);
+            if (domino.ConnectDomino(connectee, pos)) {
+                expected_ends[expected.Size] = { static_cast<uint8_t>(pos), static_cast<uint8_t>(domino.GetSideNumber(pos)) };
+                expected.Add(DominoMove(tile, static_cast<uint8_t>(pos)));
+            }
+        }
+    }
+    if (expected.Size == 0) {
+        expected.Add(DominoMove());
+    }
+
+    if (expected.Size != moves.Size) {
+        return false;
+    }
+    for (uint16_t i = 0; i < expected.Size; i++) {
+        if (std::find(moves.begin(), moves.end(), expected[i]) == moves.end()) {
+            return false;
+        }
+        if (expected[i].IsPass()) {
+            continue;
+        }
+        // The open end left by the engine has to be the number the connected domino shows on that side
+        DominoEngine next = engine;
+        next.PlayMove(expected[i]);
+        const uint8_t new_end = expected_ends[i][0] == TileDropPosition_Left ? next.GetLeftEnd() : next.GetRightEnd();
+        if (new_end != expected_ends[i][1]) {
+            return false;
+        }
+    }
+    return true;
+}
+#endif
+
+//-----------------------------------------------------------------------------------------------------------------------
+// Perft
+//-----------------------------------------------------------------------------------------------------------------------
+
+// The engine's legal moves with the random draw replaced by a draw of every boneyard tile
+template<typename Engine>
+static void GeneratePerftMoves(const Engine& engine, DominoMoveList& moves)
+{
+    engine.GenerateMoves(moves);
+    if constexpr (Engine::RuleSet::UsesBoneyard) {
+        if (moves[0].IsDraw()) {
+            moves.Clear();
+            for (auto m = engine.GetBoneyard(); m; m = dengine::WithoutLowestTile(m)) {
+                moves.Add(DominoMove(dengine::LowestTile(m), EngineSide_Draw));
+            }
+        }
+    }
+}
+
+template<typename Engine, uint16_t N>
+static void Perft(Engine& engine, int depth, const PerftOptions& options, PerftCounts& counts)
+{
+    counts.DeepestPly = std::max(counts.DeepestPly, depth);
+    if (engine.IsGameOver()) {
+        engine.RemainingCards(engine.GetWinner()) == 0 ? counts.Wins++ : counts.Blocked++;
+        return;
+    }
+    if (depth == options.MaxDepth) {
+        return;
+    }
+
+    DominoMoveList moves;
+    GeneratePerftMoves(engine, moves);
+#ifdef PERFT_VERIFY_WITH_GAMELOGIC
+    if constexpr (std::is_same_v<Engine, DominoEngine>) {
+        if (options.Verify && !VerifyMoves(engine, moves)) {
+            counts.Mismatches++;
+        }
+    }
+#endif
+
+    counts.Nodes[depth + 1] += moves.Size;
+    typename Engine::UndoRecord undo;
+    for (const auto& move : moves) {
+        counts.Passes += move.IsPass();
+        counts.Draws  += move.IsDraw();
+        engine.template MakeMoveN<N>(move, undo);
+        Perft<Engine, N>(engine, depth + 1, options, counts);
+        engine.UnmakeMove(undo);
+    }
+}
+
+// Expands the tree until there are enough subtrees to keep every thread busy
+template<typename Engine>
+static void SplitRoot(const Engine& engine, int depth, size_t wanted, const PerftOptions& options, PerftCounts& counts, std::vector<std::pair<Engine, int>>& tasks)
+{
+    std::vector<std::pair<Engine, int>> frontier = { { engine, depth } };
+    while (frontier.size() < wanted) {
+        std::vector<std::pair<Engine, int>> next_frontier;
+        bool expanded = false;
+        for (auto& [position, d] : frontier) {
+            if (position.IsGameOver() || d == options.MaxDepth) {
+                next_frontier.emplace_back(position, d);
+                continue;
+            }
+            DominoMoveList moves;
+            GeneratePerftMoves(position, moves);
+            counts.Nodes[d + 1] += moves.Size;
+            for (const auto& move : moves) {
+                counts.Passes += move.IsPass();
+                counts.Draws  += move.IsDraw();
+                Engine next = position;
+                next.PlayMove(move);
+                next_frontier.emplace_back(next, d + 1);
+            }
+            expanded = true;
+        }
+        frontier.swap(next_frontier);
+        if (!expanded) {
+            break;
+        }
+    }
+    tasks = std::move(frontier);
+}
+
+static bool ParseOptions(int argc, char** argv, PerftOptions& options)
+{
+    for (int i = 1; i < argc; i++) {
+        const char* arg = argv[i];
+        if (!std::strcmp(arg, "--verify")) {
+            options.Verify = true;
+            continue;
+        }
+
+        const char* value = i + 1 < argc ? argv[++i] : nullptr;
+        if (value == nullptr) {
+            std::fprintf(stderr, "Missing value for %s\n", arg);
+            return false;
+        }
+
+        if      (!std::strcmp(arg, "--players"))    options.Players   = static_cast<uint16_t>(std::strtoul(value, nullptr, 10));
+        else if (!std::strcmp(arg, "--seed"))       options.Seed      = static_cast<uint32_t>(std::strtoul(value, nullptr, 10));
+        else if (!std::strcmp(arg, "--deals"))      options.Deals     = std::max(1ul, std::strtoul(value, nullptr, 10));
+        else if (!std::strcmp(arg, "--depth"))      options.MaxDepth  = std::clamp(std::atoi(value), 0, MaxPerftDepth - 1);
+        else if (!std::strcmp(arg, "--threads"))    options.Threads   = std::max(1ul, std::strtoul(value, nullptr, 10));
+        else if (!std::strcmp(arg, "--first-turn")) options.FirstTurn = std::atoi(value);
+        else if (!std::strcmp(arg, "--set"))        options.Set       = static_cast<uint16_t>(std::strtoul(value, nullptr, 10));
+        else if (!std::strcmp(arg, "--cards"))      options.Cards     = static_cast<uint16_t>(std::strtoul(value, nullptr, 10));
+        else if (!std::strcmp(arg, "--rules"))      options.Rules     = value;
+        else {
+            std::fprintf(stderr, "Unknown option %s\n", arg);
+            return false;
+        }
+    }
+
+    const uint16_t max_players = options.Set == 6 ? dengine::DoubleSix::MaxPlayers : (options.Set == 9 ? dengine::DoubleNine::MaxPlayers : dengine::DoubleTwelve::MaxPlayers);
+    const uint16_t tiles       = options.Set == 6 ? dengine::DoubleSix::NumberOfTiles : (options.Set == 9 ? dengine::DoubleNine::NumberOfTiles : dengine::DoubleTwelve::NumberOfTiles);
+    if (options.Set != 6 && options.Set != 9 && options.Set != 12) {
+        std::fprintf(stderr, "--set must be 6, 9 or 12\n");
+        return false;
+    }
+    if (options.Players < dengine::MinPlayers || options.Players > max_players) {
+        std::fprintf(stderr, "--players must be between 4 and %d for the double-%d set\n", max_players, options.Set);
+        return false;
+    }
+    if (options.Cards > dengine::MaxCards || options.Cards * options.Players > tiles) {
+        std::fprintf(stderr, "--cards must be at most %d and deal at most %d tiles\n", dengine::MaxCards, tiles);
+        return false;
+    }
+    if (options.Rules != dengine::BlockRules::Name && options.Rules != dengine::DrawRules::Name && options.Rules != dengine::AllFivesRules::Name) {
+        std::fprintf(stderr, "--rules must be block, draw or allfives\n");
+        return false;
+    }
+    if (options.Rules != dengine::BlockRules::Name && options.Set != 6) {
+        std::fprintf(stderr, "--rules %s only works with the double-six set\n", options.Rules.c_str());
+        return false;
+    }
+    if (options.Verify && (options.Set != 6 || options.Rules != dengine::BlockRules::Name)) {
+        std::fprintf(stderr, "--verify only works with the double-six set and the block rules of the game\n");
+        return false;
+    }
+#ifndef PERFT_VERIFY_WITH_GAMELOGIC
+    if (options.Verify) {
+        std::fprintf(stderr, "--verify needs the tool built with PERFT_VERIFY_WITH_GAMELOGIC and the game sources\n");
+        return false;
+    }
+#endif
+    return true;
+}
+
+// Runs the perft specialized for the number of players of the position
+template<typename Engine>
+static void PerftPosition(const Engine& engine, int depth, const PerftOptions& options, PerftCounts& counts)
+{
+    Engine position = engine;
+    dengine::DispatchPlayers<typename Engine::TileSet>(engine.GetNumberOfPlayers(), [&](auto players) {
+        Perft<Engine, players()>(position, depth, options, counts);
+    });
+}
+
+template<typename Engine>
+static PerftCounts RunPerft(const std::vector<Engine>& roots, const PerftOptions& options, uint32_t threads)
+{
+    PerftCounts counts;
+    if (threads == 1) {
+        for (const auto& root : roots) {
+            PerftPosition(root, 0, options, counts);
+        }
+        return counts;
+    }
+
+    std::vector<std::pair<Engine, int>> tasks;
+    for (const auto& root : roots) {
+        std::vector<std::pair<Engine, int>> root_tasks;
+        SplitRoot(root, 0, roots.size() >= threads * 16 ? 1 : threads * 16, options, counts, root_tasks);
+        tasks.insert(tasks.end(), root_tasks.begin(), root_tasks.end());
+    }
+
+    std::mutex            merge_mutex;
+    std::atomic<size_t>   next_task = 0;
+    std::vector<std::thread> workers;
+    for (uint32_t t = 0; t < threads; t++) {
+        workers.emplace_back([&] {
+            PerftCounts local;
+            for (size_t task = next_task++; task < tasks.size(); task = next_task++) {
+                PerftPosition(tasks[task].first, tasks[task].second, options, local);
+            }
+            std::lock_guard lock(merge_mutex);
+            counts.Merge(local);
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    return counts;
+}
+
+template<typename Engine>
+static void RunDeals(const PerftOptions& options)
+{
+    std::vector<Engine> roots(options.Deals);
+    for (uint32_t deal = 0; deal < options.Deals; deal++) {
+        roots[deal].NewGame(options.Players, options.Seed + deal, options.FirstTurn, options.Cards);
+    }
+    std::printf("set: double-%d  rules: %s  cards: %d  ", Engine::TileSet::HighestPip, Engine::RuleSet::Name, roots[0].GetNumberOfCards());
+    if (options.Deals == 1) {
+        std::printf("players: %d  seed: %u  first turn: Player %d\n", options.Players, options.Seed, roots[0].GetFirstTurn() + 1);
+    }
+    else {
+        std::printf("players: %d  seeds: %u-%u\n", options.Players, options.Seed, options.Seed + options.Deals - 1);
+    }
+
+    // Single threaded run first, then the multi threaded one which has to give the same counts
+    for (uint32_t threads : { 1u, options.Threads }) {
+        const auto        start   = std::chrono::steady_clock::now();
+        const PerftCounts counts  = RunPerft(roots, options, threads);
+        const double      seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        if (threads == 1) {
+            for (int d = 1; d <= counts.DeepestPly; d++) {
+                std::printf("depth %3d: %llu\n", d, static_cast<unsigned long long>(counts.Nodes[d]));
+            }
+            std::printf("passes: %llu  wins: %llu  blocked: %llu\n", static_cast<unsigned long long>(counts.Passes),
+                static_cast<unsigned long long>(counts.Wins), static_cast<unsigned long long>(counts.Blocked));
+            if constexpr (Engine::RuleSet::UsesBoneyard) {
+                std::printf("draws: %llu\n", static_cast<unsigned long long>(counts.Draws));
+            }
+            if (options.Verify) {
+                std::printf("ConnectDomino mismatches: %llu\n", static_cast<unsigned long long>(counts.Mismatches));
+            }
+        }
+
+        const uint64_t nodes = counts.TotalNodes();
+        std::printf("threads: %u  nodes: %llu  time: %.3f s  nodes/sec: %.0f\n", threads, static_cast<unsigned long long>(nodes),
+            seconds, seconds > 0.0 ? nodes / seconds : 0.0);
+
+        if (options.Threads == 1) {
+            break;
+        }
+    }
+}
+
+int main(int argc, char** argv)
+{
+    PerftOptions options;
+    if (!ParseOptions(argc, argv, options)) {
+        return 1;
+    }
+
+    if (options.Rules == dengine::DrawRules::Name) {
+        RunDeals<BasicDominoEngine<dengine::DoubleSix, dengine::DrawRules>>(options);
+        return 0;
+    }
+    if (options.Rules == dengine::AllFivesRules::Name) {
+        RunDeals<BasicDominoEngine<dengine::DoubleSix, dengine::AllFivesRules>>(options);
+        return 0;
+    }
+
+    switch (options.Set)
+    {
+    case 9:  RunDeals<BasicDominoEngine<dengine::DoubleNine>>(options);   break;
+    case 12: RunDeals<BasicDominoEngine<dengine::DoubleTwelve>>(options); break;
+    default: RunDeals<DominoEngine>(options);                             break;
+    }
+    return 0;
+}
@@ -0,0 +1,126 @@
+// Speed benchmark of the rule variants.
+//
+// Plays --games random games of every variant and table size from the same seeds and reports the games and moves per
+// second, plus the size of every engine. The variants are compile-time policies of BasicDominoEngine, so the block
+// engine has the same size and the same inner loop as before the variants were added: its numbers here and the Perft
+// nodes/sec are the ones to compare between builds. The other rows show what the boneyard and the scoring cost.
+//
+// Usage:
+//   RulesBenchmark [--games N] [--players 4-8 | 0 for all] [--seed N] [--repeat N]
+
+#include "../DominoLogics/DominoEngine.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+struct BenchmarkOptions
+{
+    uint32_t Games   = 200000;
+    uint16_t Players = 0;
+    uint32_t Seed    = 1;
+    uint32_t Repeat  = 3;
+};
+
+struct BenchmarkResult
+{
+    uint64_t Moves    = 0;
+    uint64_t Draws    = 0;
+    uint64_t Checksum = 0;   // Winners and scores, so the games can't be optimized away and runs can be compared
+    double   Seconds  = 0.0;
+};
+
+// Random playouts specialized for the number of players, picking the moves with a xorshift generator so the
+// benchmark measures the engine and not std::mt19937
+template<typename Engine, uint16_t N>
+static void PlayGames(const BenchmarkOptions& options, BenchmarkResult& result)
+{
+    Engine         engine;
+    DominoMoveList moves;
+    for (uint32_t game = 0; game < options.Games; game++) {
+        const uint32_t seed  = options.Seed + game;
+        uint32_t       state = seed * 2654435761u | 1u;
+        engine.NewGame(N, seed);
+
+        while (!engine.IsGameOver()) {
+            engine.GenerateMoves(moves);
+            state ^= state << 13;
+            state ^= state >> 17;
+            state ^= state << 5;
+            const DominoMove& move = moves[state % moves.Size];
+            result.Draws += move.IsDraw();
+            engine.template PlayMoveN<N>(move);
+            result.Moves++;
+        }
+        result.Checksum = result.Checksum * 31 + engine.GetWinner() * 1000 + engine.GetScore(engine.GetWinner());
+    }
+}
+
+template<typename Engine>
+static void RunVariant(const BenchmarkOptions& options)
+{
+    for (uint16_t players = dengine::MinPlayers; players <= dengine::MaxPlayers; players++) {
+        if (options.Players != 0 && players != options.Players) {
+            continue;
+        }
+
+        // Best of --repeat runs, the least disturbed by the rest of the machine
+        BenchmarkResult best;
+        for (uint32_t run = 0; run < options.Repeat; run++) {
+            BenchmarkResult result;
+            const auto start = std::chrono::steady_clock::now();
+            dengine::DispatchPlayers(players, [&](auto n) { PlayGames<Engine, n()>(options, result); });
+            result.Seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            if (run == 0 || result.Seconds < best.Seconds) {
+                best = result;
+            }
+        }
+
+        std::printf("%-9s %7d %12zu %14.0f %14.0f %10llu  %016llx\n", Engine::RuleSet::Name, players, sizeof(Engine),
+            options.Games / best.Seconds, best.Moves / best.Seconds, static_cast<unsigned long long>(best.Draws),
+            static_cast<unsigned long long>(best.Checksum));
+    }
+}
+
+static bool ParseOptions(int argc, char** argv, BenchmarkOptions& options)
+{
+    for (int i = 1; i < argc; i++) {
+        const char* arg   = argv[i];
+        const char* value = i + 1 < argc ? argv[++i] : nullptr;
+        if (value == nullptr) {
+            std::fprintf(stderr, "Missing value for %s\n", arg);
+            return false;
+        }
+
+        if      (!std::strcmp(arg, "--games"))   options.Games   = std::max(1ul, std::strtoul(value, nullptr, 10));
+        else if (!std::strcmp(arg, "--players")) options.Players = static_cast<uint16_t>(std::strtoul(value, nullptr, 10));
+        else if (!std::strcmp(arg, "--seed"))    options.Seed    = static_cast<uint32_t>(std::strtoul(value, nullptr, 10));
+        else if (!std::strcmp(arg, "--repeat"))  options.Repeat  = std::max(1ul, std::strtoul(value, nullptr, 10));
+        else {
+            std::fprintf(stderr, "Unknown option %s\n", arg);
+            return false;
+        }
+    }
+
+    if (options.Players != 0 && (options.Players < dengine::MinPlayers || options.Players > dengine::MaxPlayers)) {
+        std::fprintf(stderr, "--players must be between 4 and 8, or 0 for every table size\n");
+        return false;
+    }
+    return true;
+}
+
+int main(int argc, char** argv)
+{
+    BenchmarkOptions options;
+    if (!ParseOptions(argc, argv, options)) {
+        return 1;
+    }
+
+    std::printf("games: %u  seeds: %u-%u  best of %u runs\n", options.Games, options.Seed, options.Seed + options.Games - 1, options.Repeat);
+    std::printf("%-9s %7s %12s %14s %14s %10s  %s\n", "rules", "players", "engine bytes", "games/sec", "moves/sec", "draws", "checksum");
+    RunVariant<DominoEngine>(options);
+    RunVariant<BasicDominoEngine<dengine::DoubleSix, dengine::DrawRules>>(options);
+    RunVariant<BasicDominoEngine<dengine::DoubleSix, dengine::AllFivesRules>>(options);
+    return 0;
+}
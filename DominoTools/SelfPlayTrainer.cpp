@@ -0,0 +1,324 @@
+// Self-play trainer for the DominoEvaluator weights.
+//
+// Worker threads play games against themselves with the current weights (plus some exploration) and label every
+// position with the final result of the game, FindTheLowestSum included for blocked games. The examples are streamed
+// through a bounded queue into an online logistic regression, so memory stays flat no matter how many games are
+// played. The weights are checkpointed every --checkpoint examples and handed back to the workers.
+//
+// Usage:
+//   SelfPlayTrainer [--games N] [--threads N] [--players 4-8 | 0 for all] [--seed N] [--explore F]
+//                   [--rate F] [--l2 F] [--checkpoint N] [--init weights.txt] [--out weights.txt]
+//                   [--dump examples.bin] [--fit examples.bin] [--epochs N]
+
+#include "../DominoLogics/DominoEngine.h"
+#include "../DominoLogics/DominoEvaluator.h"
+#include <atomic>
+#include <cmath>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+struct TrainingExample
+{
+    EvalFeatures Features;
+    float        Label;
+};
+
+struct TrainerOptions
+{
+    uint64_t    Games           = 100000;
+    uint32_t    Threads         = std::max(1u, std::thread::hardware_concurrency());
+    uint16_t    Players         = 0;
+    uint32_t    Seed            = 1;
+    float       Explore         = 0.10f;
+    float       LearningRate    = 0.01f;
+    float       L2              = 1e-5f;
+    uint64_t    CheckpointEvery = 200000;
+    uint32_t    Epochs          = 1;
+    std::string InitPath;
+    std::string OutPath         = "domino_weights.txt";
+    std::string DumpPath;
+    std::string FitPath;
+};
+
+//-----------------------------------------------------------------------------------------------------------------------
+// ExampleQueue CLASS
+//-----------------------------------------------------------------------------------------------------------------------
+
+// Bounded multi-producer/single-consumer queue. Producers block while the trainer is behind
+class ExampleQueue
+{
+private:
+    std::mutex                  Mutex;
+    std::condition_variable     NotEmpty;
+    std::condition_variable     NotFull;
+    std::deque<TrainingExample> Examples;
+    size_t                      Capacity;
+    uint32_t                    Producers;
+
+public:
+    ExampleQueue(size_t capacity, uint32_t producers) : Capacity(capacity), Producers(producers) {}
+
+    void Push(const std::vector<TrainingExample>& examples)
+    {
+        std::unique_lock lock(Mutex);
+        NotFull.wait(lock, [this] { return Examples.size() < Capacity; });
+        Examples.insert(Examples.end(), examples.begin(), examples.end());
+        NotEmpty.notify_one();
+    }
+
+    void ProducerDone()
+    {
+        std::lock_guard lock(Mutex);
+        Producers--;
+        NotEmpty.notify_one();
+    }
+
+    bool Pop(TrainingExample& example)
+    {
+        std::unique_lock lock(Mutex);
+        NotEmpty.wait(lock, [this] { return !Examples.empty() || Producers == 0; });
+        if (Examples.empty()) {
+            return false;
+        }
+        example = Examples.front();
+        Examples.pop_front();
+        NotFull.notify_one();
+        return true;
+    }
+};
+
+//-----------------------------------------------------------------------------------------------------------------------
+// SharedWeights CLASS
+//-----------------------------------------------------------------------------------------------------------------------
+
+// The latest checkpointed weights that the workers play with
+class SharedWeights
+{
+private:
+    std::mutex  Mutex;
+    EvalWeights Weights;
+    uint32_t    Version = 0;
+
+public:
+    void Publish(const EvalWeights& weights)
+    {
+        std::lock_guard lock(Mutex);
+        Weights = weights;
+        Version++;
+    }
+
+    uint32_t Fetch(EvalWeights& weights, uint32_t known_version)
+    {
+        std::lock_guard lock(Mutex);
+        if (Version != known_version) {
+            weights = Weights;
+        }
+        return Version;
+    }
+};
+
+//-----------------------------------------------------------------------------------------------------------------------
+// Self-play
+//-----------------------------------------------------------------------------------------------------------------------
+
+static void SelfPlayWorker(const TrainerOptions& options, std::atomic<uint64_t>& next_game, SharedWeights& shared, ExampleQueue& queue)
+{
+    DominoEvaluator              evaluator;
+    DominoEngine                 engine;
+    EvalWeights                  weights;
+    uint32_t                     version = UINT32_MAX;
+    std::vector<TrainingExample> game_examples;
+    std::vector<uint16_t>        example_player;
+
+    for (uint64_t game = next_game++; game < options.Games; game = next_game++) {
+        const uint32_t new_version = shared.Fetch(weights, version);
+        if (new_version != version) {
+            version = new_version;
+            evaluator.SetWeights(weights);
+        }
+
+        const uint32_t game_seed = options.Seed + static_cast<uint32_t>(game);
+        const uint16_t players   = options.Players != 0 ? options.Players : static_cast<uint16_t>(dengine::MinPlayers + game % 5);
+        std::mt19937   rng(game_seed ^ 0x9E3779B9u);
+        engine.NewGame(players, game_seed);
+
+        game_examples.clear();
+        example_player.clear();
+        while (!engine.IsGameOver()) {
+            // Every player's view of the position becomes an example
+            for (uint16_t p = 0; p < players; p++) {
+                TrainingExample& example = game_examples.emplace_back();
+                DominoEvaluator::ExtractFeatures(engine, p, example.Features);
+                example_player.push_back(p);
+            }
+            engine.PlayMove(evaluator.SelectMove(engine, rng, options.Explore));
+        }
+
+        for (size_t i = 0; i < game_examples.size(); i++) {
+            game_examples[i].Label = example_player[i] == engine.GetWinner() ? 1.0f : 0.0f;
+        }
+        queue.Push(game_examples);
+    }
+
+    queue.ProducerDone();
+}
+
+//-----------------------------------------------------------------------------------------------------------------------
+// Logistic regression
+//-----------------------------------------------------------------------------------------------------------------------
+
+class OnlineTrainer
+{
+private:
+    const TrainerOptions& Options;
+    DominoEvaluator       Evaluator;
+    SharedWeights*        Shared;
+    std::ofstream         Dump;
+    uint64_t              Seen         = 0;
+    double                LossSum      = 0.0;
+    uint64_t              LossExamples = 0;
+
+public:
+    OnlineTrainer(const TrainerOptions& options, SharedWeights* shared) : Options(options), Shared(shared)
+    {
+        if (!options.InitPath.empty() && !Evaluator.LoadWeights(options.InitPath.c_str())) {
+            std::fprintf(stderr, "Could not load the weights from %s, starting from the defaults\n", options.InitPath.c_str());
+        }
+        if (!options.DumpPath.empty()) {
+            Dump.open(options.DumpPath, std::ios::binary | std::ios::trunc);
+        }
+        if (Shared != nullptr) {
+            Shared->Publish(Evaluator.GetWeights());
+        }
+    }
+
+    void Train(const TrainingExample& example)
+    {
+        if (Dump.is_open()) {
+            Dump.write(reinterpret_cast<const char*>(&example), sizeof(example));
+        }
+
+        EvalWeights& weights   = Evaluator.GetWeights();
+        const float  predicted = Evaluator.EvaluateFeatures(example.Features);
+        const float  error     = predicted - example.Label;
+        for (int i = 0; i < EvalFeature_COUNT; i++) {
+            const float decay = i == EvalFeature_Bias ? 0.0f : Options.L2 * weights[i];
+            weights[i] -= Options.LearningRate * (error * example.Features[i] + decay);
+        }
+
+        const float clamped = std::min(std::max(predicted, 1e-6f), 1.0f - 1e-6f);
+        LossSum -= example.Label > 0.5f ? std::log(clamped) : std::log(1.0f - clamped);
+        LossExamples++;
+
+        if (++Seen % Options.CheckpointEvery == 0) {
+            Checkpoint();
+        }
+    }
+
+    void Checkpoint()
+    {
+        std::printf("examples: %llu  log loss: %.5f\n", static_cast<unsigned long long>(Seen), LossExamples ? LossSum / LossExamples : 0.0);
+        std::fflush(stdout);
+        LossSum      = 0.0;
+        LossExamples = 0;
+
+        if (!Evaluator.SaveWeights(Options.OutPath.c_str())) {
+            std::fprintf(stderr, "Could not write the weights to %s\n", Options.OutPath.c_str());
+        }
+        if (Shared != nullptr) {
+            Shared->Publish(Evaluator.GetWeights());
+        }
+    }
+};
+
+static bool ParseOptions(int argc, char** argv, TrainerOptions& options)
+{
+    for (int i = 1; i < argc; i++) {
+        const char* arg   = argv[i];
+        const char* value = i + 1 < argc ? argv[i + 1] : nullptr;
+        if (value == nullptr) {
+            std::fprintf(stderr, "Missing value for %s\n", arg);
+            return false;
+        }
+        i++;
+
+        if      (!std::strcmp(arg, "--games"))      options.Games           = std::strtoull(value, nullptr, 10);
+        else if (!std::strcmp(arg, "--threads"))    options.Threads         = std::max(1ul, std::strtoul(value, nullptr, 10));
+        else if (!std::strcmp(arg, "--players"))    options.Players         = static_cast<uint16_t>(std::strtoul(value, nullptr, 10));
+        else if (!std::strcmp(arg, "--seed"))       options.Seed            = static_cast<uint32_t>(std::strtoul(value, nullptr, 10));
+        else if (!std::strcmp(arg, "--explore"))    options.Explore         = std::strtof(value, nullptr);
+        else if (!std::strcmp(arg, "--rate"))       options.LearningRate    = std::strtof(value, nullptr);
+        else if (!std::strcmp(arg, "--l2"))         options.L2              = std::strtof(value, nullptr);
+        else if (!std::strcmp(arg, "--checkpoint")) options.CheckpointEvery = std::max(1ull, std::strtoull(value, nullptr, 10));
+        else if (!std::strcmp(arg, "--epochs"))     options.Epochs          = static_cast<uint32_t>(std::strtoul(value, nullptr, 10));
+        else if (!std::strcmp(arg, "--init"))       options.InitPath        = value;
+        else if (!std::strcmp(arg, "--out"))        options.OutPath         = value;
+        else if (!std::strcmp(arg, "--dump"))       options.DumpPath        = value;
+        else if (!std::strcmp(arg, "--fit"))        options.FitPath         = value;
+        else {
+            std::fprintf(stderr, "Unknown option %s\n", arg);
+            return false;
+        }
+    }
+
+    if (options.Players != 0 && (options.Players < dengine::MinPlayers || options.Players > dengine::MaxPlayers)) {
+        std::fprintf(stderr, "--players must be between 4 and 8, or 0 for every table size\n");
+        return false;
+    }
+    return true;
+}
+
+int main(int argc, char** argv)
+{
+    TrainerOptions options;
+    if (!ParseOptions(argc, argv, options)) {
+        return 1;
+    }
+
+    // Fit from a previous dump, streaming it from disk every epoch
+    if (!options.FitPath.empty()) {
+        OnlineTrainer trainer(options, nullptr);
+        for (uint32_t epoch = 0; epoch < options.Epochs; epoch++) {
+            std::ifstream file(options.FitPath, std::ios::binary);
+            if (!file) {
+                std::fprintf(stderr, "Could not open %s\n", options.FitPath.c_str());
+                return 1;
+            }
+            TrainingExample example;
+            while (file.read(reinterpret_cast<char*>(&example), sizeof(example))) {
+                trainer.Train(example);
+            }
+        }
+        trainer.Checkpoint();
+        return 0;
+    }
+
+    SharedWeights         shared;
+    ExampleQueue          queue(1 << 16, options.Threads);
+    OnlineTrainer         trainer(options, &shared);
+    std::atomic<uint64_t> next_game = 0;
+
+    std::vector<std::thread> workers;
+    for (uint32_t t = 0; t < options.Threads; t++) {
+        workers.emplace_back(SelfPlayWorker, std::cref(options), std::ref(next_game), std::ref(shared), std::ref(queue));
+    }
+
+    TrainingExample example;
+    while (queue.Pop(example)) {
+        trainer.Train(example);
+    }
+
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    trainer.Checkpoint();
+    return 0;
+}
@@ -0,0 +1,516 @@
+// Endgame tablebase generator.
+//
+// Solves every position of the block game with --max-tiles tiles or less in the hands of a --players table and
+// writes the results for Tablebase to map, see Tablebase.h. The tables are built backwards from the end of the game,
+// one material signature (the hand sizes of a section) at a time, fewest tiles first: a tile played leads to a section
+// of one tile less that is already solved, and a pass to a position of the same tiles that is solved on the spot,
+// since there can't be more passes in a row than players. The game can't go back to more tiles, so every position is
+// final after a single pass over it and no unmoves are needed.
+//
+// The sections of the same number of tiles only look at the level below, so a whole level is cut in chunks of
+// positions and solved by --threads workers. Every worker starts with a run of chunks of its own and steals from the
+// back of the others' once it's out. The results are spilled to a file per section under --work-dir and memory
+// mapped, so the memory holds the pages of the level being solved and of the one below, not the whole table. The
+// chunks done are checkpointed every --checkpoint seconds and after every level, and a run started again with the same
+// options resumes from there. The work directory is removed once the table is written.
+//
+// The default --max-tiles is a tile per player. Every tile past that makes the table more than ten times bigger, and
+// the positions with a tile a hand grow with the players: four players have 83 million of them, five players 2.4
+// billion.
+//
+// Usage:
+//   TablebaseGenerator [--players 4-8] [--max-tiles N] [--out path] [--threads N] [--work-dir path]
+//                      [--checkpoint seconds]
+
+#include "../DominoLogics/Tablebase.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+struct GeneratorOptions
+{
+    uint16_t    Players           = dengine::MinPlayers;
+    uint16_t    MaxTiles          = 0;
+    uint32_t    Threads           = std::max(1u, std::thread::hardware_concurrency());
+    uint32_t    CheckpointSeconds = 60;
+    std::string OutPath;
+    std::string WorkDir;
+};
+
+//-----------------------------------------------------------------------------------------------------------------------
+// ChunkQueues CLASS
+//-----------------------------------------------------------------------------------------------------------------------
+
+// A queue of chunks per worker. A worker takes its own from the front and steals from the back of the others', so the
+// thief takes the chunks the owner would get to last and the two don't walk over the same pages
+class ChunkQueues
+{
+private:
+    struct Queue
+    {
+        std::mutex           Mutex;
+        std::deque<uint64_t> Chunks;
+    };
+    std::vector<Queue> Queues;
+
+public:
+    explicit ChunkQueues(uint32_t workers) : Queues(workers) {}
+
+    void Push(uint32_t worker, uint64_t chunk)
+    {
+        std::lock_guard lock(Queues[worker].Mutex);
+        Queues[worker].Chunks.push_back(chunk);
+    }
+
+    // False once every queue is empty. Nothing is pushed while the workers run, so then the level is done
+    bool Pop(uint32_t worker, uint64_t& chunk)
+    {
+        for (uint32_t i = 0; i < Queues.size(); i++) {
+            Queue&          queue = Queues[(worker + i) % Queues.size()];
+            std::lock_guard lock(queue.Mutex);
+            if (!queue.Chunks.empty()) {
+                if (i == 0) {
+                    chunk = queue.Chunks.front();
+                    queue.Chunks.pop_front();
+                }
+                else {
+                    chunk = queue.Chunks.back();
+                    queue.Chunks.pop_back();
+                }
+                return true;
+            }
+        }
+        return false;
+    }
+};
+
+//-----------------------------------------------------------------------------------------------------------------------
+// TablebaseSolver CLASS
+//-----------------------------------------------------------------------------------------------------------------------
+
+class TablebaseSolver
+{
+private:
+    // Hands blocks of a chunk. A chunk is a multiple of the positions of the same hands, which are unranked once
+    static constexpr uint64_t HandsPerChunk = 1024;
+
+    const GeneratorOptions&           Options;
+    uint16_t                          Players;
+    std::vector<tablebase::HandSizes> Sections;
+    std::vector<uint32_t>             SectionOfKey;
+    std::vector<uint32_t>             Levels;          // First section of every level, and the end of the last one
+    std::vector<MappedFile>           Results;         // One byte a position, spilled to the work directory
+    uint64_t                          ChunkPositions;
+    std::vector<uint64_t>             FirstChunk;      // Of every section, and the end of the last one
+    std::vector<std::atomic<bool>>    ChunkDone;
+
+    std::mutex                        Mutex;
+    std::condition_variable           WorkersDone;
+    uint32_t                          Running = 0;
+
+public:
+    TablebaseSolver(const GeneratorOptions& options) :
+        Options(options),
+        Players(options.Players),
+        Sections(tablebase::Sections(options.Players, options.MaxTiles)),
+        SectionOfKey(tablebase::NumberOfKeys(options.Players)),
+        Results(Sections.size()),
+        ChunkPositions(HandsPerChunk * options.Players * tablebase::EndStates)
+    {
+        uint16_t level_tiles = 0;
+        FirstChunk.push_back(0);
+        for (uint32_t s = 0; s < Sections.size(); s++) {
+            SectionOfKey[tablebase::SectionKey(Players, Sections[s])] = s;
+            if (const uint16_t tiles = this->Tiles(s); tiles != level_tiles) {
+                Levels.push_back(s);
+                level_tiles = tiles;
+            }
+            FirstChunk.push_back(FirstChunk.back() + (this->NumberOfPositions(s) + ChunkPositions - 1) / ChunkPositions);
+        }
+        Levels.push_back(static_cast<uint32_t>(Sections.size()));
+        ChunkDone = std::vector<std::atomic<bool>>(FirstChunk.back());
+    }
+
+    const std::vector<tablebase::HandSizes>& GetSections() const { return Sections; }
+
+    uint64_t NumberOfPositions(uint32_t section) const
+    {
+        return tablebase::NumberOfPositions(Players, Sections[section]);
+    }
+
+    // Picks the chunks up from the checkpoint of an earlier run with the same table, if there's one
+    bool LoadCheckpoint()
+    {
+        std::ifstream file(this->CheckpointPath());
+        std::string   magic;
+        uint32_t      players = 0, max_tiles = 0;
+        uint64_t      chunk_positions = 0;
+        if (!(file >> magic >> players >> max_tiles >> chunk_positions) || magic != "DTB1" || players != Players ||
+            max_tiles != Options.MaxTiles || chunk_positions != ChunkPositions) {
+            return false;
+        }
+
+        uint32_t    section;
+        std::string done;
+        while (file >> section >> done) {
+            // A chunk only counts with the spill file it was written to
+            std::error_code error;
+            if (section >= Sections.size() || done.size() != FirstChunk[section + 1] - FirstChunk[section] ||
+                std::filesystem::file_size(this->SpillPath(section), error) != this->NumberOfPositions(section)) {
+                continue;
+            }
+            for (size_t c = 0; c < done.size(); c++) {
+                ChunkDone[FirstChunk[section] + c] = done[c] == '1';
+            }
+        }
+        return true;
+    }
+
+    uint64_t ChunksDone() const
+    {
+        return std::count_if(ChunkDone.begin(), ChunkDone.end(), [](const std::atomic<bool>& done) { return done.load(); });
+    }
+
+    // Solves the levels in order, fewest tiles first. False if a spill file couldn't be mapped or checkpointed
+    bool Solve()
+    {
+        for (uint32_t level = 0; level + 1 < Levels.size(); level++) {
+            const uint32_t first = Levels[level], end = Levels[level + 1];
+            if (this->LevelDone(level)) {
+                continue;
+            }
+
+            // Only the level below is looked at, the ones under it stay on the disk
+            if (!this->MapLevel(level) || (level > 0 && !this->MapLevel(level - 1))) {
+                return false;
+            }
+            for (uint32_t s = 0; s < (level > 0 ? Levels[level - 1] : 0); s++) {
+                Results[s].Close();
+            }
+
+            // Every worker gets a run of the chunks left in the level
+            std::vector<uint64_t> chunks;
+            uint64_t              positions = 0;
+            for (uint64_t c = FirstChunk[first]; c < FirstChunk[end]; c++) {
+                if (!ChunkDone[c]) {
+                    uint64_t chunk_first, chunk_end;
+                    this->ChunkRange(c, chunk_first, chunk_end);
+                    chunks.push_back(c);
+                    positions += chunk_end - chunk_first;
+                }
+            }
+            const uint32_t workers = static_cast<uint32_t>(std::min<uint64_t>(Options.Threads, chunks.size()));
+            ChunkQueues    queues(workers);
+            for (size_t i = 0; i < chunks.size(); i++) {
+                queues.Push(static_cast<uint32_t>(i * workers / chunks.size()), chunks[i]);
+            }
+
+            const auto start = std::chrono::steady_clock::now();
+            Running = workers;
+            std::vector<std::thread> threads;
+            for (uint32_t w = 0; w < workers; w++) {
+                threads.emplace_back(&TablebaseSolver::Work, this, w, std::ref(queues));
+            }
+            bool checkpointed = true;
+            {
+                std::unique_lock lock(Mutex);
+                while (!WorkersDone.wait_for(lock, std::chrono::seconds(Options.CheckpointSeconds), [this] { return Running == 0; })) {
+                    lock.unlock();
+                    checkpointed = this->SaveCheckpoint(level) && checkpointed;
+                    lock.lock();
+                }
+            }
+            for (auto& thread : threads) {
+                thread.join();
+            }
+            if (!this->SaveCheckpoint(level) || !checkpointed) {
+                std::fprintf(stderr, "Could not checkpoint to %s\n", this->CheckpointPath().c_str());
+                return false;
+            }
+
+            const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            std::printf("tiles %u: %u sections  %llu positions  %zu chunks  %.1fs  %.0f positions/sec\n", this->Tiles(first), end - first,
+                static_cast<unsigned long long>(positions), chunks.size(), seconds, positions / seconds);
+            std::fflush(stdout);
+        }
+        return true;
+    }
+
+    // The results of a section, mapped again after the solve
+    const MappedFile* MapResults(uint32_t section)
+    {
+        return Results[section].OpenRead(this->SpillPath(section).c_str()) ? &Results[section] : nullptr;
+    }
+
+    void CloseResults(uint32_t section)
+    {
+        Results[section].Close();
+    }
+
+private:
+    uint16_t Tiles(uint32_t section) const
+    {
+        uint16_t tiles = 0;
+        for (uint16_t p = 0; p < Players; p++) {
+            tiles += Sections[section][p];
+        }
+        return tiles;
+    }
+
+    std::string SpillPath(uint32_t section) const
+    {
+        return (std::filesystem::path(Options.WorkDir) / ("section_" + std::to_string(section) + ".bin")).string();
+    }
+
+    std::string CheckpointPath() const
+    {
+        return (std::filesystem::path(Options.WorkDir) / "checkpoint.txt").string();
+    }
+
+    bool LevelDone(uint32_t level) const
+    {
+        return std::all_of(ChunkDone.begin() + FirstChunk[Levels[level]], ChunkDone.begin() + FirstChunk[Levels[level + 1]],
+            [](const std::atomic<bool>& done) { return done.load(); });
+    }
+
+    bool MapLevel(uint32_t level)
+    {
+        for (uint32_t s = Levels[level]; s < Levels[level + 1]; s++) {
+            if (!Results[s].IsOpen() && !Results[s].OpenWrite(this->SpillPath(s).c_str(), this->NumberOfPositions(s))) {
+                std::fprintf(stderr, "Could not map %s\n", this->SpillPath(s).c_str());
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Writes the chunks done so far. Their results are flushed first, so the checkpoint never gets ahead of the disk
+    bool SaveCheckpoint(uint32_t level)
+    {
+        std::vector<std::string> done(Sections.size());
+        for (uint32_t s = 0; s < Sections.size(); s++) {
+            for (uint64_t c = FirstChunk[s]; c < FirstChunk[s + 1]; c++) {
+                done[s] += ChunkDone[c].load(std::memory_order_acquire) ? '1' : '0';
+            }
+        }
+        for (uint32_t s = Levels[level]; s < Levels[level + 1]; s++) {
+            if (!Results[s].Flush()) {
+                return false;
+            }
+        }
+
+        // Written aside and renamed over the old one, so a crash leaves one of the two whole
+        const std::string temporary = this->CheckpointPath() + ".tmp";
+        {
+            std::ofstream file(temporary, std::ios::trunc);
+            file << "DTB1 " << Players << ' ' << Options.MaxTiles << ' ' << ChunkPositions << '\n';
+            for (uint32_t s = 0; s < Sections.size(); s++) {
+                if (done[s].find('1') != std::string::npos) {
+                    file << s << ' ' << done[s] << '\n';
+                }
+            }
+            if (!file.flush()) {
+                return false;
+            }
+        }
+        std::error_code error;
+        std::filesystem::rename(temporary, this->CheckpointPath(), error);
+        return !error;
+    }
+
+    void Work(uint32_t worker, ChunkQueues& queues)
+    {
+        uint64_t chunk;
+        while (queues.Pop(worker, chunk)) {
+            this->SolveChunk(chunk);
+            ChunkDone[chunk].store(true, std::memory_order_release);
+        }
+
+        std::lock_guard lock(Mutex);
+        if (--Running == 0) {
+            WorkersDone.notify_one();
+        }
+    }
+
+    // The section of a chunk and its positions in there
+    uint32_t ChunkRange(uint64_t chunk, uint64_t& first, uint64_t& end) const
+    {
+        const uint32_t section = static_cast<uint32_t>(std::upper_bound(FirstChunk.begin(), FirstChunk.end(), chunk) - FirstChunk.begin() - 1);
+        first = (chunk - FirstChunk[section]) * ChunkPositions;
+        end   = std::min(first + ChunkPositions, this->NumberOfPositions(section));
+        return section;
+    }
+
+    void SolveChunk(uint64_t chunk)
+    {
+        uint64_t                    first, end;
+        const uint32_t              section   = this->ChunkRange(chunk, first, end);
+        const tablebase::HandSizes& cards     = Sections[section];
+        const uint32_t              per_hands = Players * tablebase::EndStates;
+        uint8_t*                    results   = Results[section].GetData();
+
+        DominoEngine hands, engine;
+        for (uint64_t start = first; start < end; start += per_hands) {
+            tablebase::UnindexPosition(Players, cards, start, hands);
+            for (uint32_t i = 0; i < per_hands; i++) {
+                engine = hands;
+                engine.SetBoardEnds(static_cast<uint8_t>(i % tablebase::EndStates / (dengine::HighestPip + 1)), static_cast<uint8_t>(i % (dengine::HighestPip + 1)));
+                engine.SetTurns(0, static_cast<uint16_t>(i / tablebase::EndStates), hands.GetNumberOfTurns());
+                results[start + i] = static_cast<uint8_t>(this->SolvePosition(engine));
+            }
+        }
+    }
+
+    // The winner of a position under perfect play, the same max-n choice as BasicDominoSearch::MaxN
+    uint16_t SolvePosition(const DominoEngine& engine) const
+    {
+        DominoMoveList moves;
+        engine.GenerateMoves(moves);
+        const uint16_t mover        = engine.GetCurrentTurn();
+        uint16_t       first_winner = mover;
+        for (uint16_t i = 0; i < moves.Size; i++) {
+            DominoEngine child = engine;
+            child.PlayMove(moves[i]);
+            const uint16_t winner = child.IsGameOver() ? child.GetWinner() : (moves[i].IsPass() ? this->SolvePosition(child) : this->Solved(child));
+            if (winner == mover) {
+                return mover;
+            }
+            if (i == 0) {
+                first_winner = winner;
+            }
+        }
+        return first_winner;
+    }
+
+    // The winner of a position of the level below
+    uint16_t Solved(const DominoEngine& engine) const
+    {
+        tablebase::HandSizes cards;
+        tablebase::GetHandSizes(engine, cards);
+        const uint8_t result = Results[SectionOfKey[tablebase::SectionKey(Players, cards)]].GetData()[tablebase::IndexPosition(engine)];
+        return (engine.GetCurrentTurn() + result) % Players;
+    }
+};
+
+static bool ParseOptions(int argc, char** argv, GeneratorOptions& options)
+{
+    for (int i = 1; i < argc; i++) {
+        const char* arg   = argv[i];
+        const char* value = i + 1 < argc ? argv[++i] : nullptr;
+        if (value == nullptr) {
+            std::fprintf(stderr, "Missing value for %s\n", arg);
+            return false;
+        }
+
+        if      (!std::strcmp(arg, "--players"))    options.Players           = static_cast<uint16_t>(std::strtoul(value, nullptr, 10));
+        else if (!std::strcmp(arg, "--max-tiles"))  options.MaxTiles          = static_cast<uint16_t>(std::strtoul(value, nullptr, 10));
+        else if (!std::strcmp(arg, "--out"))        options.OutPath           = value;
+        else if (!std::strcmp(arg, "--threads"))    options.Threads           = std::max(1ul, std::strtoul(value, nullptr, 10));
+        else if (!std::strcmp(arg, "--work-dir"))   options.WorkDir           = value;
+        else if (!std::strcmp(arg, "--checkpoint")) options.CheckpointSeconds = std::max(1ul, std::strtoul(value, nullptr, 10));
+        else {
+            std::fprintf(stderr, "Unknown option %s\n", arg);
+            return false;
+        }
+    }
+
+    if (options.Players < dengine::MinPlayers || options.Players > dengine::MaxPlayers) {
+        std::fprintf(stderr, "--players must be between 4 and 8\n");
+        return false;
+    }
+    if (options.MaxTiles == 0) {
+        options.MaxTiles = options.Players;
+    }
+    if (options.MaxTiles < options.Players) {
+        std::fprintf(stderr, "--max-tiles must be at least a tile per player\n");
+        return false;
+    }
+    if (options.OutPath.empty()) {
+        options.OutPath = Tablebase::DefaultPath(options.Players);
+    }
+    if (options.WorkDir.empty()) {
+        options.WorkDir = options.OutPath + ".work";
+    }
+    return true;
+}
+
+int main(int argc, char** argv)
+{
+    GeneratorOptions options;
+    if (!ParseOptions(argc, argv, options)) {
+        return 1;
+    }
+
+    // The table is only opened once everything is solved, a table already at the path is kept until then
+    if (!TablebaseWriter::Fits(options.Players, options.MaxTiles)) {
+        std::fprintf(stderr, "The sections don't fit a 64-bit index\n");
+        return 1;
+    }
+    std::error_code error;
+    std::filesystem::create_directories(options.WorkDir, error);
+    if (error) {
+        std::fprintf(stderr, "Could not create %s\n", options.WorkDir.c_str());
+        return 1;
+    }
+
+    TablebaseSolver solver(options);
+    std::printf("players: %u  max tiles: %u  sections: %zu  threads: %u\n", options.Players, options.MaxTiles, solver.GetSections().size(), options.Threads);
+    if (solver.LoadCheckpoint()) {
+        std::printf("resuming from %s: %llu chunks done\n", options.WorkDir.c_str(), static_cast<unsigned long long>(solver.ChunksDone()));
+    }
+    std::fflush(stdout);
+
+    const auto start = std::chrono::steady_clock::now();
+    if (!solver.Solve()) {
+        return 1;
+    }
+
+    TablebaseWriter writer;
+    if (!writer.Begin(options.OutPath.c_str(), options.Players, options.MaxTiles)) {
+        std::fprintf(stderr, "Could not write %s\n", options.OutPath.c_str());
+        return 1;
+    }
+
+    for (uint32_t s = 0; s < solver.GetSections().size(); s++) {
+        const MappedFile* results = solver.MapResults(s);
+        if (results == nullptr) {
+            std::fprintf(stderr, "Could not map the results of section %u\n", s);
+            return 1;
+        }
+        const uint8_t* data       = results->GetData();
+        const uint64_t positions  = results->GetSize();
+        uint64_t       mover_wins = 0;
+        for (uint64_t i = 0; i < positions; i++) {
+            mover_wins += data[i] == 0;
+        }
+        std::printf("section");
+        for (uint16_t p = 0; p < options.Players; p++) {
+            std::printf(" %u", solver.GetSections()[s][p]);
+        }
+        std::printf(": %llu positions  mover wins %.1f%%\n", static_cast<unsigned long long>(positions), 100.0 * mover_wins / positions);
+
+        if (!writer.WriteSection(data, positions)) {
+            std::fprintf(stderr, "Could not write %s\n", options.OutPath.c_str());
+            return 1;
+        }
+        solver.CloseResults(s);
+    }
+    if (!writer.End()) {
+        std::fprintf(stderr, "Could not write %s\n", options.OutPath.c_str());
+        return 1;
+    }
+    std::filesystem::remove_all(options.WorkDir, error);
+    std::printf("done in %.1fs\n", std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+    return 0;
+}
@@ -1,62 +1,85 @@
-#pragma once
-
-#include <iostream>
-#include "imgui.h"
-#include "GameLogic.h"
-
-enum AiDifficulty_
-{
-	AiDifficulty_Easy       = 0,
-	AiDifficulty_Hard       = 1,
-	AiDifficulty_ReallyHard = 2,
-	AiDifficulty_GiveUp     = 3
-};
-
-class MainWindow
-{
-private:
-	bool     CloseWindowBool = false;
-	bool     GameStart       = false;
-	bool     GameEnd         = false;
-	bool     ShowPassButton  = false;
-	bool     OpenGameLogs    = false;
-	bool     OpenOptions     = false;
-	bool     OpenHelp        = false;
-	int      NumberOfPlayer  = 4;
-	float    AIAttackSpeed   = 1.25f;
-	std::pair<bool, bool>           ShowDropOptions;
-	std::pair<Domino2D, Domino2D>   TemporaryConnectee;
-	std::pair<Domino2D, Domino2D>   DropOptions;
-	std::pair<Domino2D*, Domino2D*> ConnecteePointer;
-
-	void MainMenuBar();
-
-	// UI Domino Functions
-	void RenderGameBoard();
-	bool GameStartButton();
-	bool FirstDominoButton();
-	//void AddDominoes(Domino2D* d, int left_or_right);
-	//void RenderDominoes();
-	void RenderPlayerDominoes();
-	bool RenderPassButton();
-	void RestartGame();
-	void AIAttacks();
-	bool RenderDropOptions();
-	void OtherInfoChildWindow();
-	void GameLogWindow();
-	void GameStartOptions();
-	bool GameStartWindow();
-	bool GameEndWindow();
-	void OngoingGameWindow();
-	void BoardWindow();
-	void PlayerWindow();
-	void HelpWindow();
-	void OptionWindow();
-public:
-	MainWindow()  = default;
-	~MainWindow() = default;
-
-	void RenderWindow();
-	bool CloseWindow();
-};
-
+#pragma once
+
+#include <iostream>
+#include "imgui.h"
+#include "GameLogic.h"
+
+enum AiDifficulty_
+{
+	AiDifficulty_Easy       = 0,
+	AiDifficulty_Hard       = 1,
+	AiDifficulty_ReallyHard = 2,
+	AiDifficulty_GiveUp     = 3
+};
+
+class MainWindow
+{
+private:
+	bool     CloseWindowBool = false;
+	bool     GameStart       = false;
+	bool     GameEnd         = false;
+	bool     ShowPassButton  = false;
+	bool     OpenGameLogs    = false;
+	bool     OpenOptions     = false;
+	bool     OpenHelp        = false;
+	bool     AutoPlayForced  = false;
+	bool     ShowHints       = false;
+	int      NumberOfPlayer  = 4;
+	int      AIDifficulty    = AIDifficulty_Random;
+	float    AIAttackSpeed   = 1.25f;
+	float    PonderIdleTime  = 30.0f;   // Seconds without input before the AI stops pondering
+	double   LastInputTime   = 0.0;
+	std::pair<bool, bool>           ShowDropOptions;
+	std::pair<Domino2D, Domino2D>   TemporaryConnectee;
+	std::pair<Domino2D, Domino2D>   DropOptions;
+	std::pair<Domino2D*, Domino2D*> ConnecteePointer;
+	DominoEngine                    PreviewEngine;   // The game when the card was clicked, the drop previews are made and unmade on it
+	uint8_t                         PreviewTile = dengine::NoTile;
+	std::array<RootMove, dengine::MaxMoves> Hints;   // The human's moves ranked by the hint search, refreshed every frame
+	uint16_t                        NumberOfHints = 0;
+	WinMeter                        Meter;
+	float                           MeterCpuShare = 0.25f;
+	std::array<float, dengine::MaxPlayers> WinChances{};   // The meter's last reading, kept while it's busy
+	float                           WinRollouts   = 0.0f;
+	GameReview                      Review;           // The review of the last game, see ReviewButton
+
+	void MainMenuBar();
+
+	// UI Domino Functions
+	void RenderGameBoard();
+	bool GameStartButton();
+	bool FirstDominoButton();
+	bool ReviewButton();
+	//void AddDominoes(Domino2D* d, int left_or_right);
+	//void RenderDominoes();
+	void RenderPlayerDominoes();
+	bool RenderPassButton();
+	void RestartGame();
+	void AIAttacks();
+	void AIPonders();
+	void UpdateWinMeter();
+	void PlayerForcedMove();
+	void PlayForcedMove(const DominoMove& move);
+	bool RenderDropOptions();
+	void DropPreviewTooltip(int domino_pos);
+	// The rank of the clicked card on a drop option among the hints, -1 if it has none
+	int  FindDropHint(int domino_pos) const;
+	void DropHintOverlay(int domino_pos);
+	void OtherInfoChildWindow();
+	void GameLogWindow();
+	void GameStartOptions();
+	bool GameStartWindow();
+	bool GameEndWindow();
+	void OngoingGameWindow();
+	void BoardWindow();
+	void PlayerWindow();
+	void HelpWindow();
+	void OptionWindow();
+public:
+	MainWindow()  = default;
+	~MainWindow() = default;
+
+	void RenderWindow();
+	bool CloseWindow();
+};
+